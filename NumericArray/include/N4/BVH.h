@@ -0,0 +1,571 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef N4_BVH_H
+#define N4_BVH_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <N4/SIMD.h>
+#include <N4/Triangle.h>
+#include <N4/Vertex4f.h>
+
+namespace n4 {
+
+  ////// Types ///////////////////////////////////////////////////////////////
+
+  /*
+   * NOTE:
+   * Nodes are stored in depth-first order; i.e. the left child of an inner
+   * node immediately follows its parent and 'index' refers to the right
+   * child. A leaf's 'index' refers to its block of four triangles, 'count'
+   * is the number of triangles in use. Two nodes share one cache line.
+   */
+  struct alignas(32) BVHNode {
+    real_t        bbMin[3];
+    std::uint32_t index;
+    real_t        bbMax[3];
+    std::uint32_t count;
+
+    inline bool isLeaf() const
+    {
+      return count > 0;
+    }
+  };
+
+  static_assert(sizeof(BVHNode) == 32);
+
+  struct BVHHit {
+    real_t        t{0};
+    real_t        u{0};
+    real_t        v{0};
+    std::uint32_t triangle{0};
+  };
+
+  ////// Implementation //////////////////////////////////////////////////////
+
+  namespace impl {
+
+    inline real_t bvhAt(const simd::simd_t& x, const std::size_t k)
+    {
+      alignas(16) real_t a[4];
+      simd::store(a, x);
+      return a[k];
+    }
+
+    struct BVHBox {
+      BVHBox() noexcept
+        : lo{simd::set(std::numeric_limits<real_t>::max())}
+        , hi{simd::set(std::numeric_limits<real_t>::lowest())}
+      {
+      }
+
+      inline void grow(const simd::simd_t& p)
+      {
+        lo = simd::min(lo, p);
+        hi = simd::max(hi, p);
+      }
+
+      inline void grow(const BVHBox& box)
+      {
+        lo = simd::min(lo, box.lo);
+        hi = simd::max(hi, box.hi);
+      }
+
+      // NOTE: Half the surface area suffices for the SAH.
+      inline real_t area() const
+      {
+        alignas(16) real_t d[4];
+        simd::store(d, simd::max(simd::sub(hi, lo), simd::zero()));
+        return d[0]*d[1] + d[1]*d[2] + d[2]*d[0];
+      }
+
+      simd::simd_t lo, hi;
+    };
+
+    struct BVHPrimitive {
+      BVHBox       box;
+      simd::simd_t centroid;
+    };
+
+    struct BVHBuildNode {
+      BVHBox                        box;
+      std::size_t                   begin{0};
+      std::size_t                   count{0};
+      std::unique_ptr<BVHBuildNode> child[2];
+    };
+
+    /*
+     * NOTE:
+     * Binned SAH build of Wald, "On fast Construction of SAH-based Bounding
+     * Volume Hierarchies", 2007. Subtrees above spawnDepth are built by
+     * separate threads; they partition disjoint ranges of refs.
+     */
+    class BVHBuilder {
+    public:
+      static constexpr std::size_t      BinCount = 16;
+      static constexpr std::size_t      MaxDepth = 64;
+      static constexpr std::size_t   MaxLeafSize = 4;
+      static constexpr std::size_t MinSpawnCount = 4096;
+
+      BVHBuilder(const std::vector<BVHPrimitive>& prims,
+                 std::vector<std::uint32_t>& refs,
+                 const std::size_t spawnDepth) noexcept
+        : _prims{prims}
+        , _refs{refs}
+        , _spawnDepth{spawnDepth}
+      {
+      }
+
+      std::unique_ptr<BVHBuildNode> build(const std::size_t begin, const std::size_t count,
+                                          const std::size_t depth) const
+      {
+        std::unique_ptr<BVHBuildNode> node = std::make_unique<BVHBuildNode>();
+        node->begin = begin;
+        node->count = count;
+
+        BVHBox centroids;
+        for(std::size_t i = begin; i < begin + count; i++) {
+          node->box.grow(_prims[_refs[i]].box);
+          centroids.grow(_prims[_refs[i]].centroid);
+        }
+
+        if( count <= MaxLeafSize ) {
+          return node;
+        }
+
+        const std::size_t half = split(begin, count, depth, centroids);
+
+        if( depth < _spawnDepth  &&  count >= MinSpawnCount ) {
+          std::future<std::unique_ptr<BVHBuildNode>> left =
+              std::async(std::launch::async, &BVHBuilder::build, this, begin, half, depth + 1);
+          node->child[1] = build(begin + half, count - half, depth + 1);
+          node->child[0] = left.get();
+        } else {
+          node->child[0] = build(begin, half, depth + 1);
+          node->child[1] = build(begin + half, count - half, depth + 1);
+        }
+
+        return node;
+      }
+
+    private:
+      // NOTE: Returns the size of the left partition.
+      std::size_t split(const std::size_t begin, const std::size_t count,
+                        const std::size_t depth, const BVHBox& centroids) const
+      {
+        alignas(16) real_t lo[4], extent[4];
+        simd::store(lo, centroids.lo);
+        simd::store(extent, simd::sub(centroids.hi, centroids.lo));
+
+        std::uint32_t *first = _refs.data() + begin;
+        std::uint32_t  *last = first + count;
+
+        // (1) Beyond half the maximum depth, bound the remaining depth. /////
+
+        if( depth < MaxDepth/2 ) {
+          std::size_t bestAxis = 0;
+          std::size_t  bestBin = BinCount;
+          real_t      bestCost = std::numeric_limits<real_t>::max();
+
+          for(std::size_t k = 0; k < 3; k++) {
+            if( extent[k] <= 0 ) {
+              continue;
+            }
+
+            BVHBox      boxes[BinCount];
+            std::size_t counts[BinCount] = {};
+            for(const std::uint32_t *ref = first; ref != last; ref++) {
+              const std::size_t b = bin(_prims[*ref].centroid, k, lo[k], extent[k]);
+              boxes[b].grow(_prims[*ref].box);
+              counts[b]++;
+            }
+
+            // (2) Sweep right to left, then evaluate left to right. /////////
+
+            real_t rightCost[BinCount];
+            BVHBox      right;
+            std::size_t rightCount = 0;
+            for(std::size_t b = BinCount - 1; b > 0; b--) {
+              right.grow(boxes[b]);
+              rightCount += counts[b];
+              rightCost[b] = rightCount > 0
+                  ? right.area()*real_t(rightCount)
+                  : std::numeric_limits<real_t>::max();
+            }
+
+            BVHBox      left;
+            std::size_t leftCount = 0;
+            for(std::size_t b = 0; b < BinCount - 1; b++) {
+              left.grow(boxes[b]);
+              leftCount += counts[b];
+              if( leftCount == 0  ||  leftCount == count ) {
+                continue;
+              }
+
+              const real_t cost = left.area()*real_t(leftCount) + rightCost[b + 1];
+              if( cost < bestCost ) {
+                bestAxis = k;
+                bestBin  = b;
+                bestCost = cost;
+              }
+            }
+          }
+
+          if( bestBin < BinCount ) {
+            const std::uint32_t *middle =
+                std::partition(first, last, [&](const std::uint32_t ref) -> bool {
+              return bin(_prims[ref].centroid, bestAxis, lo[bestAxis], extent[bestAxis]) <= bestBin;
+            });
+            return static_cast<std::size_t>(middle - first);
+          }
+        }
+
+        // (3) Object median along the largest extent. ///////////////////////
+
+        const std::size_t axis = extent[0] > extent[1]
+            ? (extent[0] > extent[2] ? 0 : 2)
+            : (extent[1] > extent[2] ? 1 : 2);
+        const std::size_t half = count/2;
+        std::nth_element(first, first + half, last,
+                         [&](const std::uint32_t a, const std::uint32_t b) -> bool {
+          return bvhAt(_prims[a].centroid, axis) < bvhAt(_prims[b].centroid, axis);
+        });
+
+        return half;
+      }
+
+      inline static std::size_t bin(const simd::simd_t& centroid, const std::size_t k,
+                                    const real_t lo, const real_t extent)
+      {
+        const real_t x = (bvhAt(centroid, k) - lo)*(real_t(BinCount)/extent);
+        return std::min<std::size_t>(static_cast<std::size_t>(std::max<real_t>(x, 0)),
+                                     BinCount - 1);
+      }
+
+      const std::vector<BVHPrimitive>& _prims;
+      std::vector<std::uint32_t>&      _refs;
+      std::size_t                      _spawnDepth{0};
+    };
+
+    /*
+     * NOTE:
+     * Intersects the first count triangles of a leaf; ids holds their
+     * original indices. Updates tMax and hit upon a closer hit.
+     */
+    template<bool WATERTIGHT, bool ANY_HIT>
+    inline bool bvhLeaf(const simd::Triangle4& triangles, const std::uint32_t *ids,
+                        const std::uint32_t count,
+                        const simd::simd_t& org, const simd::simd_t& dir,
+                        const real_t tMin, real_t& tMax, BVHHit& hit)
+    {
+      simd::TriangleHit4 tris;
+      const int mask = simd::intersectRayTriangle4<WATERTIGHT>(triangles, org, dir, tMin, tMax, tris)
+          & ((1 << count) - 1);
+
+      // NOTE: The kernel already rejects hits beyond tMax.
+      if constexpr( ANY_HIT ) {
+        return mask != 0;
+      }
+
+      bool found = false;
+      for(std::uint32_t l = 0; l < count; l++) {
+        if( (mask & (1 << l)) == 0  ||  tris.t[l] > tMax ) {
+          continue;
+        }
+        tMax  = tris.t[l];
+        hit.t = tris.t[l];
+        hit.u = tris.u[l];
+        hit.v = tris.v[l];
+        hit.triangle = ids[l];
+        found = true;
+      }
+
+      return found;
+    }
+
+  } // namespace impl
+
+  ////// Bounding Volume Hierarchy ///////////////////////////////////////////
+
+  class BVH {
+  public:
+    static constexpr std::size_t StackSize = impl::BVHBuilder::MaxDepth;
+
+    BVH() noexcept = default;
+
+    ~BVH() noexcept = default;
+
+    /*
+     * NOTE:
+     * Builds the hierarchy of triangleCount triangles, each referencing
+     * three vertices through indices. A threadCount of zero uses all
+     * hardware threads.
+     */
+    void build(const Vertex4f *vertices, const std::uint32_t *indices,
+               const std::size_t triangleCount, std::size_t threadCount = 0)
+    {
+      _nodes.clear();
+      _triangles.clear();
+      _ids.clear();
+      if( triangleCount < 1 ) {
+        return;
+      }
+
+      if( threadCount < 1 ) {
+        threadCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+      }
+
+      // (1) Primitive Bounds ////////////////////////////////////////////////
+
+      std::vector<impl::BVHPrimitive> prims(triangleCount);
+      std::vector<std::uint32_t>       refs(triangleCount);
+
+      const auto bound = [&](const std::size_t begin, const std::size_t end) -> void {
+        for(std::size_t i = begin; i < end; i++) {
+          impl::BVHPrimitive& prim = prims[i];
+          prim.box.grow(vertices[indices[3*i + 0]].eval());
+          prim.box.grow(vertices[indices[3*i + 1]].eval());
+          prim.box.grow(vertices[indices[3*i + 2]].eval());
+          prim.centroid = simd::mul(simd::add(prim.box.lo, prim.box.hi), simd::set(0.5));
+          refs[i] = static_cast<std::uint32_t>(i);
+        }
+      };
+
+      const std::size_t chunk = (triangleCount + threadCount - 1)/threadCount;
+      std::vector<std::thread> threads;
+      for(std::size_t begin = chunk; begin < triangleCount; begin += chunk) {
+        threads.emplace_back(bound, begin, std::min(begin + chunk, triangleCount));
+      }
+      bound(0, std::min(chunk, triangleCount));
+      for(std::thread& thread : threads) {
+        thread.join();
+      }
+
+      // (2) Hierarchy ///////////////////////////////////////////////////////
+
+      std::size_t spawnDepth = 0;
+      while( (std::size_t{1} << spawnDepth) < threadCount ) {
+        spawnDepth++;
+      }
+
+      const impl::BVHBuilder builder(prims, refs, spawnDepth);
+      const std::unique_ptr<impl::BVHBuildNode> root = builder.build(0, triangleCount, 0);
+
+      // (3) Flatten /////////////////////////////////////////////////////////
+
+      flatten(root.get(), vertices, indices, refs);
+    }
+
+    /*
+     * NOTE:
+     * Returns the closest hit within [tMin, tMax]; hit.triangle is the index
+     * of the triangle as passed to build(). Children are visited front to
+     * back and subtrees beyond the closest hit so far are skipped.
+     */
+    template<bool WATERTIGHT = false, typename Direction>
+    bool intersect(const Vertex4f& org, const Direction& dir, BVHHit& hit,
+                   const real_t tMin = 0,
+                   real_t tMax = std::numeric_limits<real_t>::infinity()) const
+    {
+      return traverse<WATERTIGHT,false>(org.eval(), dir.eval(), hit, tMin, tMax);
+    }
+
+    /*
+     * NOTE:
+     * Returns true upon the first hit within [tMin, tMax]; e.g. for shadow
+     * rays.
+     */
+    template<bool WATERTIGHT = false, typename Direction>
+    bool occluded(const Vertex4f& org, const Direction& dir,
+                  const real_t tMin = 0,
+                  const real_t tMax = std::numeric_limits<real_t>::infinity()) const
+    {
+      BVHHit hit;
+      return traverse<WATERTIGHT,true>(org.eval(), dir.eval(), hit, tMin, tMax);
+    }
+
+    inline const std::vector<BVHNode>& nodes() const
+    {
+      return _nodes;
+    }
+
+    inline const std::vector<simd::Triangle4>& triangles() const
+    {
+      return _triangles;
+    }
+
+    inline const std::vector<std::uint32_t>& triangleIds() const
+    {
+      return _ids;
+    }
+
+  private:
+    struct StackEntry {
+      std::uint32_t node;
+      real_t        tNear;
+    };
+
+    template<bool WATERTIGHT, bool ANY_HIT>
+    bool traverse(const simd::simd_t& org, const simd::simd_t& dir, BVHHit& hit,
+                  const real_t tMin, real_t tMax) const
+    {
+      if( _nodes.empty() ) {
+        return false;
+      }
+
+      const simd::simd_t invDir = simd::inverseDirection(dir);
+
+      StackEntry stack[StackSize];
+      std::size_t top = 0;
+
+      real_t tNear;
+      if( !slab(_nodes[0], org, invDir, tMin, tMax, tNear) ) {
+        return false;
+      }
+      stack[top++] = {0, tNear};
+
+      bool found = false;
+      while( top > 0 ) {
+        const StackEntry entry = stack[--top];
+        if( entry.tNear > tMax ) {
+          continue;
+        }
+
+        std::uint32_t index = entry.node;
+        while( !_nodes[index].isLeaf() ) {
+          const std::uint32_t left  = index + 1;
+          const std::uint32_t right = _nodes[index].index;
+
+          real_t tLeft, tRight;
+          const bool hitLeft  = slab(_nodes[left],  org, invDir, tMin, tMax, tLeft);
+          const bool hitRight = slab(_nodes[right], org, invDir, tMin, tMax, tRight);
+
+          if( hitLeft  &&  hitRight ) {
+            if( tLeft <= tRight ) {
+              stack[top++] = {right, tRight};
+              index = left;
+            } else {
+              stack[top++] = {left, tLeft};
+              index = right;
+            }
+          } else if( hitLeft ) {
+            index = left;
+          } else if( hitRight ) {
+            index = right;
+          } else {
+            break;
+          }
+        }
+
+        const BVHNode& node = _nodes[index];
+        if( !node.isLeaf() ) {
+          continue;
+        }
+
+        if( impl::bvhLeaf<WATERTIGHT,ANY_HIT>(_triangles[node.index], &_ids[4*node.index], node.count,
+                                              org, dir, tMin, tMax, hit) ) {
+          if constexpr( ANY_HIT ) {
+            return true;
+          }
+          found = true;
+        }
+      }
+
+      return found;
+    }
+
+    // NOTE: w of the loaded rows holds the node's index and count.
+    inline static bool slab(const BVHNode& node,
+                            const simd::simd_t& org, const simd::simd_t& invDir,
+                            const real_t tMin, const real_t tMax, real_t& tNear)
+    {
+      return simd::intersectRayAABBox(simd::load(node.bbMin), simd::load(node.bbMax),
+                                      org, invDir, tMin, tMax, tNear);
+    }
+
+    std::uint32_t flatten(const impl::BVHBuildNode *build,
+                          const Vertex4f *vertices, const std::uint32_t *indices,
+                          const std::vector<std::uint32_t>& refs)
+    {
+      const std::uint32_t index = static_cast<std::uint32_t>(_nodes.size());
+      _nodes.emplace_back();
+
+      alignas(16) real_t lo[4], hi[4];
+      simd::store(lo, build->box.lo);
+      simd::store(hi, build->box.hi);
+      for(std::size_t k = 0; k < 3; k++) {
+        _nodes[index].bbMin[k] = lo[k];
+        _nodes[index].bbMax[k] = hi[k];
+      }
+
+      if( !build->child[0] ) {
+        _nodes[index].index = static_cast<std::uint32_t>(_triangles.size());
+        _nodes[index].count = static_cast<std::uint32_t>(build->count);
+
+        // NOTE: Unused lanes repeat a vertex; degenerate triangles never hit.
+        simd::Triangle4& tris = _triangles.emplace_back();
+        for(std::size_t l = 0; l < 4; l++) {
+          const std::uint32_t id = l < build->count
+              ? refs[build->begin + l]
+              : refs[build->begin];
+          const real_t *p0 = vertices[indices[3*id + 0]].data();
+          const real_t *p1 = l < build->count ? vertices[indices[3*id + 1]].data() : p0;
+          const real_t *p2 = l < build->count ? vertices[indices[3*id + 2]].data() : p0;
+          tris.set(l, p0, p1, p2);
+          _ids.push_back(id);
+        }
+      } else {
+        flatten(build->child[0].get(), vertices, indices, refs);
+        const std::uint32_t right = flatten(build->child[1].get(), vertices, indices, refs);
+        _nodes[index].index = right;
+        _nodes[index].count = 0;
+      }
+
+      return index;
+    }
+
+    std::vector<BVHNode>         _nodes;
+    std::vector<simd::Triangle4> _triangles;
+    std::vector<std::uint32_t>   _ids;
+  };
+
+} // namespace n4
+
+#endif // N4_BVH_H
@@ -56,10 +56,17 @@ namespace n4 {
     };
 
     struct BinMul {
+      static constexpr bool have_fmadd = true;
+
       inline static simd_t eval(const simd_t& a, const simd_t& b)
       {
         return simd::mul(a, b);
       }
+
+      inline static simd_t fmadd(const simd_t& a, const simd_t& b, const simd_t& c)
+      {
+        return simd::fmadd(a, b, c);
+      }
     };
 
     struct BinSub {
@@ -69,6 +76,35 @@ namespace n4 {
       }
     };
 
+    /*
+     * NOTE:
+     * Fuse a product on either side of an addition; cf. OP::fmadd().
+     */
+    template<typename traits_T, typename ARG1, typename ARG2>
+    class DispatchVV<BinAdd,traits_T,ARG1,ARG2>
+        : public ExprBase<traits_T,DispatchVV<BinAdd,traits_T,ARG1,ARG2>> {
+    public:
+      DispatchVV(const ARG1& arg1, const ARG2& arg2)
+        : _arg1(arg1)
+        , _arg2(arg2)
+      {
+      }
+
+      inline simd_t eval() const
+      {
+        if constexpr( n4::have_fmadd<ARG1>() ) {
+          return _arg1.fmadd(_arg2.eval());
+        } else if constexpr( n4::have_fmadd<ARG2>() ) {
+          return _arg2.fmadd(_arg1.eval());
+        }
+        return BinAdd::eval(_arg1.eval(), _arg2.eval());
+      }
+
+    private:
+      const ARG1& _arg1;
+      const ARG2& _arg2;
+    };
+
     template<typename traits_T, typename RHS>
     class BinTransform : public ExprBase<traits_T,BinTransform<traits_T,RHS>> {
     public:
@@ -84,8 +120,8 @@ namespace n4 {
         const simd_t v = _rhs.eval();
         // NOTE: y = M*v
         simd_t y = mul(SIMD_SWIZZLE(v, 0, 0, 0, 0), load(_lhs.data() + 0));
-        y = add(y, mul(SIMD_SWIZZLE(v, 1, 1, 1, 1), load(_lhs.data() + 4)));
-        y = add(y, mul(SIMD_SWIZZLE(v, 2, 2, 2, 2), load(_lhs.data() + 8)));
+        y = fmadd(SIMD_SWIZZLE(v, 1, 1, 1, 1), load(_lhs.data() + 4), y);
+        y = fmadd(SIMD_SWIZZLE(v, 2, 2, 2, 2), load(_lhs.data() + 8), y);
         if constexpr( traits_T::have_w ) {
           y = add(y, load(_lhs.data() + 12)); // NOTE: v.w == 1
         }
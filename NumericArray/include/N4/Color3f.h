@@ -58,55 +58,54 @@ namespace n4 {
   template<size_t index>
   class ColorProperty {
   public:
-    ColorProperty(real_t *base) noexcept
-      : _data(base + index)
-    {
-    }
+    ColorProperty() noexcept = default;
 
     ~ColorProperty() noexcept = default;
 
     inline operator rgb_t() const
     {
       constexpr real_t MAX_RGB = static_cast<real_t>(256.0f - EPSILON0_PCT);
-      return static_cast<rgb_t>(std::clamp<real_t>(*_data, 0, 1)*MAX_RGB);
+      return static_cast<rgb_t>(std::clamp<real_t>(data()[index], 0, 1)*MAX_RGB);
     }
 
     inline rgb_t operator=(const rgb_t c)
     {
       constexpr real_t MAX_RGB_T = static_cast<real_t>(std::numeric_limits<rgb_t>::max());
-      *_data = std::clamp<real_t>(static_cast<real_t>(c)/MAX_RGB_T, 0, 1);
+      data()[index] = std::clamp<real_t>(static_cast<real_t>(c)/MAX_RGB_T, 0, 1);
       return c;
     }
 
   private:
-    ColorProperty() noexcept = delete;
+    inline const real_t *data() const
+    {
+      return reinterpret_cast<const real_t*>(this);
+    }
 
-    real_t *_data{nullptr};
+    inline real_t *data()
+    {
+      return reinterpret_cast<real_t*>(this);
+    }
   };
 
   ////// Color Manipulator ///////////////////////////////////////////////////
 
   class Color3fManipulator {
   public:
-    Color3fManipulator(real_t *data)
-      : r(data)
-      , g(data)
-      , b(data)
-      , r8(data)
-      , g8(data)
-      , b8(data)
-    {
-    }
+    Color3fManipulator() noexcept = default;
 
     ~Color3fManipulator() noexcept = default;
 
-    VectorProperty<0> r;
-    VectorProperty<1> g;
-    VectorProperty<2> b;
+    union {
+      real_t _data[4];
+
+      VectorProperty<0> r;
+      VectorProperty<1> g;
+      VectorProperty<2> b;
 
-    ColorProperty<0> r8;
-    ColorProperty<1> g8;
-    ColorProperty<2> b8;
+      ColorProperty<0> r8;
+      ColorProperty<1> g8;
+      ColorProperty<2> b8;
+    };
 
     inline real_t luminance() const
     {
@@ -117,9 +116,6 @@ namespace n4 {
       constexpr real_t yb = 0.072169f;
       return yr*r + yg*g + yb*b;
     }
-
-  private:
-    Color3fManipulator() noexcept = delete;
   };
 
   ////// Color Traits ////////////////////////////////////////////////////////
@@ -132,6 +128,8 @@ namespace n4 {
 
   using Color3f = Vector4f<Color3fTraits,Color3fManipulator>;
 
+  static_assert(sizeof(Color3f) == 16  &&  std::is_trivially_copyable_v<Color3f>);
+
 } // namespace n4
 
 #endif // N4_COLOR3F_H
@@ -66,6 +66,8 @@ namespace n4 {
     ////// Dispatch 2 Arguments //////////////////////////////////////////////
     ///
     /// Syntax: simd_t OP::eval(simd_t, simd_t)
+    ///
+    /// Optional: simd_t OP::fmadd(simd_t a, simd_t b, simd_t c) := a*b + c
 
     template<typename OP, typename traits_T, typename ARG2>
     class DispatchSV : public ExprBase<traits_T,DispatchSV<OP,traits_T,ARG2>> {
@@ -76,11 +78,18 @@ namespace n4 {
       {
       }
 
+      static constexpr bool have_fmadd = n4::have_fmadd<OP>();
+
       inline simd_t eval() const
       {
         return OP::eval(simd::set(_arg1), _arg2.eval());
       }
 
+      inline simd_t fmadd(const simd_t& c) const
+      {
+        return OP::fmadd(simd::set(_arg1), _arg2.eval(), c);
+      }
+
     private:
       const real_t _arg1;
       const ARG2&  _arg2;
@@ -95,11 +104,18 @@ namespace n4 {
       {
       }
 
+      static constexpr bool have_fmadd = n4::have_fmadd<OP>();
+
       inline simd_t eval() const
       {
         return OP::eval(_arg1.eval(), simd::set(_arg2));
       }
 
+      inline simd_t fmadd(const simd_t& c) const
+      {
+        return OP::fmadd(_arg1.eval(), simd::set(_arg2), c);
+      }
+
     private:
       const ARG1&  _arg1;
       const real_t _arg2;
@@ -114,11 +130,18 @@ namespace n4 {
       {
       }
 
+      static constexpr bool have_fmadd = n4::have_fmadd<OP>();
+
       inline simd_t eval() const
       {
         return OP::eval(_arg1.eval(), _arg2.eval());
       }
 
+      inline simd_t fmadd(const simd_t& c) const
+      {
+        return OP::fmadd(_arg1.eval(), _arg2.eval(), c);
+      }
+
     private:
       const ARG1& _arg1;
       const ARG2& _arg2;
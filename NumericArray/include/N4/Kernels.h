@@ -0,0 +1,376 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef N4_KERNELS_H
+#define N4_KERNELS_H
+
+#include <cstddef>
+
+#include <immintrin.h>
+
+#include <cs/impl/TargetImpl.h>
+#include <cs/CPU.h>
+#include <N4/SIMD.h>
+
+/*
+ * NOTE:
+ * Batched variants of simd::inverse() and simd::transform(), compiled for
+ * SSE2, AVX2 and AVX-512 and dispatched at runtime; cf. cs/CPU.h. The AVX2
+ * and AVX-512 kernels process two and four matrices or vectors per
+ * register, respectively; one per 128bit lane.
+ * All matrices are 4x4 column-major and all vectors 4x1; both are aligned
+ * to sizeof(simd::simd_t) and packed contiguously.
+ */
+
+namespace simd {
+
+  namespace kernels {
+
+    ////// Kernels - SSE2 ////////////////////////////////////////////////////
+
+    namespace sse2 {
+
+      inline void inverse(real_t *dest, const real_t *src, const std::size_t count)
+      {
+        for(std::size_t l = 0; l < count; l++) {
+          simd::inverse(dest + 16*l, src + 16*l);
+        }
+      }
+
+      inline void transform(real_t *dest, const real_t *M, const real_t *src, const std::size_t count)
+      {
+        const simd_t col0 = load(M +  0);
+        const simd_t col1 = load(M +  4);
+        const simd_t col2 = load(M +  8);
+        const simd_t col3 = load(M + 12);
+        for(std::size_t l = 0; l < count; l++) {
+          store(dest + 4*l, simd::transform(col0, col1, col2, col3, load(src + 4*l)));
+        }
+      }
+
+    } // namespace sse2
+
+    ////// Kernels - AVX2 ////////////////////////////////////////////////////
+
+    CS_TARGET_PUSH("avx2,fma")
+
+    namespace avx2 {
+
+      struct Lanes {
+        using lanes_t = __m256;
+
+        static constexpr std::size_t Count = 2;
+
+        // NOTE: Column j of matrix k is held in the 128bit lane k of col[j].
+        inline static void load(lanes_t *col, const real_t *src)
+        {
+          const __m256 m0 = _mm256_loadu_ps(src +  0);
+          const __m256 m1 = _mm256_loadu_ps(src +  8);
+          const __m256 n0 = _mm256_loadu_ps(src + 16);
+          const __m256 n1 = _mm256_loadu_ps(src + 24);
+          col[0] = _mm256_permute2f128_ps(m0, n0, 0x20);
+          col[1] = _mm256_permute2f128_ps(m0, n0, 0x31);
+          col[2] = _mm256_permute2f128_ps(m1, n1, 0x20);
+          col[3] = _mm256_permute2f128_ps(m1, n1, 0x31);
+        }
+
+        inline static void store(real_t *dest, const lanes_t *col)
+        {
+          _mm256_storeu_ps(dest +  0, _mm256_permute2f128_ps(col[0], col[1], 0x20));
+          _mm256_storeu_ps(dest +  8, _mm256_permute2f128_ps(col[2], col[3], 0x20));
+          _mm256_storeu_ps(dest + 16, _mm256_permute2f128_ps(col[0], col[1], 0x31));
+          _mm256_storeu_ps(dest + 24, _mm256_permute2f128_ps(col[2], col[3], 0x31));
+        }
+
+        inline static lanes_t add(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm256_add_ps(a, b);
+        }
+
+        inline static lanes_t div(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm256_div_ps(a, b);
+        }
+
+        inline static lanes_t intrlvhi(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm256_unpackhi_ps(a, b);
+        }
+
+        inline static lanes_t intrlvlo(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm256_unpacklo_ps(a, b);
+        }
+
+        inline static lanes_t mul(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm256_mul_ps(a, b);
+        }
+
+        inline static lanes_t set(const real_t x, const real_t y, const real_t z, const real_t w)
+        {
+          return _mm256_setr_ps(x, y, z, w, x, y, z, w);
+        }
+
+        template<int a1, int a2, int b1, int b2>
+        inline static lanes_t shuffle(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm256_shuffle_ps(a, b, _MM_SHUFFLE(b2, b1, a2, a1));
+        }
+
+        inline static lanes_t sub(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm256_sub_ps(a, b);
+        }
+
+        template<int x, int y, int z, int w>
+        inline static lanes_t swizzle(const lanes_t& a)
+        {
+          return _mm256_permute_ps(a, _MM_SHUFFLE(w, z, y, x));
+        }
+      };
+
+    } // namespace avx2
+
+#define N4_KERNELS_NAMESPACE  avx2
+#include <N4/KernelsImpl.h>
+#undef N4_KERNELS_NAMESPACE
+
+    namespace avx2 {
+
+      inline void inverse(real_t *dest, const real_t *src, const std::size_t count)
+      {
+        std::size_t l = 0;
+        for(; l + Lanes::Count <= count; l += Lanes::Count) {
+          inverseLanes(dest + 16*l, src + 16*l);
+        }
+        sse2::inverse(dest + 16*l, src + 16*l, count - l);
+      }
+
+      inline void transform(real_t *dest, const real_t *M, const real_t *src, const std::size_t count)
+      {
+        // NOTE: Two vectors per register; one vector per 128bit lane.
+        const __m256 col0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(M +  0));
+        const __m256 col1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(M +  4));
+        const __m256 col2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(M +  8));
+        const __m256 col3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(M + 12));
+        std::size_t l = 0;
+        for(; l + 2 <= count; l += 2) {
+          const __m256 x = _mm256_loadu_ps(src + 4*l);
+          __m256 y = _mm256_mul_ps(_mm256_permute_ps(x, 0x00), col0);
+          y = _mm256_fmadd_ps(_mm256_permute_ps(x, 0x55), col1, y);
+          y = _mm256_fmadd_ps(_mm256_permute_ps(x, 0xAA), col2, y);
+          y = _mm256_fmadd_ps(_mm256_permute_ps(x, 0xFF), col3, y);
+          _mm256_storeu_ps(dest + 4*l, y);
+        }
+        if( l < count ) {
+          store(dest + 4*l, simd::transform(_mm256_castps256_ps128(col0), _mm256_castps256_ps128(col1),
+                                            _mm256_castps256_ps128(col2), _mm256_castps256_ps128(col3),
+                                            load(src + 4*l)));
+        }
+      }
+
+    } // namespace avx2
+
+    CS_TARGET_POP()
+
+    ////// Kernels - AVX-512 /////////////////////////////////////////////////
+
+    CS_TARGET_PUSH("avx512f,avx2,fma")
+
+    namespace avx512 {
+
+      struct Lanes {
+        using lanes_t = __m512;
+
+        static constexpr std::size_t Count = 4;
+
+        // NOTE: Column j of matrix k is held in the 128bit lane k of col[j].
+        inline static void load(lanes_t *col, const real_t *src)
+        {
+          col[0] = _mm512_loadu_ps(src +  0);
+          col[1] = _mm512_loadu_ps(src + 16);
+          col[2] = _mm512_loadu_ps(src + 32);
+          col[3] = _mm512_loadu_ps(src + 48);
+          transpose(col);
+        }
+
+        inline static void store(real_t *dest, const lanes_t *col)
+        {
+          lanes_t m[4] = {col[0], col[1], col[2], col[3]};
+          transpose(m);
+          _mm512_storeu_ps(dest +  0, m[0]);
+          _mm512_storeu_ps(dest + 16, m[1]);
+          _mm512_storeu_ps(dest + 32, m[2]);
+          _mm512_storeu_ps(dest + 48, m[3]);
+        }
+
+        // NOTE: Transpose the 4x4 128bit lanes of r.
+        inline static void transpose(lanes_t *r)
+        {
+          const __m512 t0 = _mm512_shuffle_f32x4(r[0], r[1], _MM_SHUFFLE(1, 0, 1, 0));
+          const __m512 t1 = _mm512_shuffle_f32x4(r[2], r[3], _MM_SHUFFLE(1, 0, 1, 0));
+          const __m512 t2 = _mm512_shuffle_f32x4(r[0], r[1], _MM_SHUFFLE(3, 2, 3, 2));
+          const __m512 t3 = _mm512_shuffle_f32x4(r[2], r[3], _MM_SHUFFLE(3, 2, 3, 2));
+          r[0] = _mm512_shuffle_f32x4(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+          r[1] = _mm512_shuffle_f32x4(t0, t1, _MM_SHUFFLE(3, 1, 3, 1));
+          r[2] = _mm512_shuffle_f32x4(t2, t3, _MM_SHUFFLE(2, 0, 2, 0));
+          r[3] = _mm512_shuffle_f32x4(t2, t3, _MM_SHUFFLE(3, 1, 3, 1));
+        }
+
+        inline static lanes_t add(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm512_add_ps(a, b);
+        }
+
+        inline static lanes_t div(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm512_div_ps(a, b);
+        }
+
+        inline static lanes_t intrlvhi(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm512_unpackhi_ps(a, b);
+        }
+
+        inline static lanes_t intrlvlo(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm512_unpacklo_ps(a, b);
+        }
+
+        inline static lanes_t mul(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm512_mul_ps(a, b);
+        }
+
+        inline static lanes_t set(const real_t x, const real_t y, const real_t z, const real_t w)
+        {
+          return _mm512_setr4_ps(x, y, z, w);
+        }
+
+        template<int a1, int a2, int b1, int b2>
+        inline static lanes_t shuffle(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm512_shuffle_ps(a, b, _MM_SHUFFLE(b2, b1, a2, a1));
+        }
+
+        inline static lanes_t sub(const lanes_t& a, const lanes_t& b)
+        {
+          return _mm512_sub_ps(a, b);
+        }
+
+        template<int x, int y, int z, int w>
+        inline static lanes_t swizzle(const lanes_t& a)
+        {
+          return _mm512_permute_ps(a, _MM_SHUFFLE(w, z, y, x));
+        }
+      };
+
+    } // namespace avx512
+
+#define N4_KERNELS_NAMESPACE  avx512
+#include <N4/KernelsImpl.h>
+#undef N4_KERNELS_NAMESPACE
+
+    namespace avx512 {
+
+      inline void inverse(real_t *dest, const real_t *src, const std::size_t count)
+      {
+        std::size_t l = 0;
+        for(; l + Lanes::Count <= count; l += Lanes::Count) {
+          inverseLanes(dest + 16*l, src + 16*l);
+        }
+        avx2::inverse(dest + 16*l, src + 16*l, count - l);
+      }
+
+      inline void transform(real_t *dest, const real_t *M, const real_t *src, const std::size_t count)
+      {
+        // NOTE: Four vectors per register; one vector per 128bit lane.
+        const __m512 col0 = _mm512_broadcast_f32x4(load(M +  0));
+        const __m512 col1 = _mm512_broadcast_f32x4(load(M +  4));
+        const __m512 col2 = _mm512_broadcast_f32x4(load(M +  8));
+        const __m512 col3 = _mm512_broadcast_f32x4(load(M + 12));
+        std::size_t l = 0;
+        for(; l + 4 <= count; l += 4) {
+          const __m512 x = _mm512_loadu_ps(src + 4*l);
+          __m512 y = _mm512_mul_ps(_mm512_permute_ps(x, 0x00), col0);
+          y = _mm512_fmadd_ps(_mm512_permute_ps(x, 0x55), col1, y);
+          y = _mm512_fmadd_ps(_mm512_permute_ps(x, 0xAA), col2, y);
+          y = _mm512_fmadd_ps(_mm512_permute_ps(x, 0xFF), col3, y);
+          _mm512_storeu_ps(dest + 4*l, y);
+        }
+        avx2::transform(dest + 4*l, M, src + 4*l, count - l);
+      }
+
+    } // namespace avx512
+
+    CS_TARGET_POP()
+
+    ////// Kernel Table //////////////////////////////////////////////////////
+
+    struct KernelTable {
+      void (*inverse)(real_t *dest, const real_t *src, const std::size_t count);
+      void (*transform)(real_t *dest, const real_t *M, const real_t *src, const std::size_t count);
+    };
+
+    inline KernelTable table(const cs::ISA isa)
+    {
+      if(        isa == cs::ISA::AVX512 ) {
+        return KernelTable{&avx512::inverse, &avx512::transform};
+      } else if( isa == cs::ISA::AVX2 ) {
+        return KernelTable{&avx2::inverse, &avx2::transform};
+      }
+      return KernelTable{&sse2::inverse, &sse2::transform};
+    }
+
+    inline const KernelTable& dispatch()
+    {
+      static const KernelTable kernels = table(cs::dispatchISA());
+      return kernels;
+    }
+
+    ////// User Interface ////////////////////////////////////////////////////
+
+    inline void inverse(real_t *dest, const real_t *src, const std::size_t count)
+    {
+      dispatch().inverse(dest, src, count);
+    }
+
+    inline void transform(real_t *dest, const real_t *M, const real_t *src, const std::size_t count)
+    {
+      dispatch().transform(dest, M, src, count);
+    }
+
+  } // namespace kernels
+
+} // namespace simd
+
+#endif // N4_KERNELS_H
@@ -0,0 +1,128 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * NOTE:
+ * This file is intentionally NOT guarded against multiple inclusion!
+ * N4/Kernels.h includes it once per ISA within namespace simd::kernels, after
+ * defining N4_KERNELS_NAMESPACE and that namespace's Lanes, and within the
+ * matching CS_TARGET_PUSH() region.
+ * Lanes holds one matrix per 128bit lane of its register type; its
+ * shuffle() and swizzle() operate on each lane like SIMD_SHUFFLE() and
+ * SIMD_SWIZZLE().
+ */
+
+#if !defined(N4_KERNELS_NAMESPACE)
+# error "Do not include KernelsImpl.h directly; include N4/Kernels.h!"
+#endif
+
+namespace N4_KERNELS_NAMESPACE {
+
+  namespace impl {
+
+    using lanes_t = Lanes::lanes_t;
+
+    inline lanes_t hadd(const lanes_t& x)
+    {
+      const lanes_t y = Lanes::add(x, Lanes::swizzle<1, 0, 3, 2>(x));
+      return            Lanes::add(y, Lanes::swizzle<3, 2, 1, 0>(y));
+    }
+
+    inline lanes_t mul2x2(const lanes_t& a, const lanes_t& b)
+    {
+      return Lanes::add(Lanes::mul(                           a,  Lanes::swizzle<0, 3, 0, 3>(b)),
+                        Lanes::mul(Lanes::swizzle<1, 0, 3, 2>(a), Lanes::swizzle<2, 1, 2, 1>(b)));
+    }
+
+    inline lanes_t adjMul2x2(const lanes_t& a, const lanes_t& b)
+    {
+      return Lanes::sub(Lanes::mul(Lanes::swizzle<3, 3, 0, 0>(a),                            b),
+                        Lanes::mul(Lanes::swizzle<1, 1, 2, 2>(a), Lanes::swizzle<2, 3, 0, 1>(b)));
+    }
+
+    inline lanes_t mulAdj2x2(const lanes_t& a, const lanes_t& b)
+    {
+      return Lanes::sub(Lanes::mul(                           a,  Lanes::swizzle<3, 0, 3, 0>(b)),
+                        Lanes::mul(Lanes::swizzle<1, 0, 3, 2>(a), Lanes::swizzle<2, 1, 2, 1>(b)));
+    }
+
+    inline lanes_t traceMul2x2(const lanes_t& a, const lanes_t& b)
+    {
+      return hadd(Lanes::mul(a, Lanes::swizzle<0, 2, 1, 3>(b)));
+    }
+
+  } // namespace impl
+
+  /*
+   * Inverse of Lanes::Count consecutive 4x4 matrices; cf. simd::inverse().
+   */
+  inline void inverseLanes(real_t *dest, const real_t *src)
+  {
+    using namespace impl;
+
+    lanes_t col[4];
+    Lanes::load(col, src);
+
+    const lanes_t detACBD = Lanes::sub(
+          Lanes::mul(Lanes::shuffle<0, 2, 0, 2>(col[0], col[2]), Lanes::shuffle<1, 3, 1, 3>(col[1], col[3])),
+          Lanes::mul(Lanes::shuffle<1, 3, 1, 3>(col[0], col[2]), Lanes::shuffle<0, 2, 0, 2>(col[1], col[3]))
+          );
+
+    const lanes_t detA = Lanes::swizzle<0, 0, 0, 0>(detACBD);
+    const lanes_t detB = Lanes::swizzle<2, 2, 2, 2>(detACBD);
+    const lanes_t detC = Lanes::swizzle<1, 1, 1, 1>(detACBD);
+    const lanes_t detD = Lanes::swizzle<3, 3, 3, 3>(detACBD);
+
+    const lanes_t A = Lanes::intrlvlo(col[0], col[1]);
+    const lanes_t B = Lanes::intrlvlo(col[2], col[3]);
+    const lanes_t C = Lanes::intrlvhi(col[0], col[1]);
+    const lanes_t D = Lanes::intrlvhi(col[2], col[3]);
+
+    const lanes_t AadjB = adjMul2x2(A, B);
+    const lanes_t DadjC = adjMul2x2(D, C);
+
+    const lanes_t detM = Lanes::div(Lanes::set(1, -1, -1, 1),
+                                    Lanes::sub(Lanes::add(Lanes::mul(detA, detD), Lanes::mul(detB, detC)),
+                                               traceMul2x2(AadjB, DadjC)));
+
+    const lanes_t X = Lanes::mul(detM, Lanes::sub(Lanes::mul(detD, A),    mul2x2(B, DadjC)));
+    const lanes_t Y = Lanes::mul(detM, Lanes::sub(Lanes::mul(detB, C), mulAdj2x2(D, AadjB)));
+    const lanes_t Z = Lanes::mul(detM, Lanes::sub(Lanes::mul(detC, B), mulAdj2x2(A, DadjC)));
+    const lanes_t W = Lanes::mul(detM, Lanes::sub(Lanes::mul(detA, D),    mul2x2(C, AadjB)));
+
+    col[0] = Lanes::shuffle<3, 2, 3, 2>(X, Z);
+    col[1] = Lanes::shuffle<1, 0, 1, 0>(X, Z);
+    col[2] = Lanes::shuffle<3, 2, 3, 2>(Y, W);
+    col[3] = Lanes::shuffle<1, 0, 1, 0>(Y, W);
+    Lanes::store(dest, col);
+  }
+
+} // namespace N4_KERNELS_NAMESPACE
@@ -36,67 +36,80 @@
 
 namespace n4 {
 
+  /*
+   * NOTE:
+   * A manipulator provides the storage of a Vector4f<>. Its properties are
+   * overlaid onto this storage through an anonymous union; they hold no
+   * state of their own and access their element relative to their own
+   * address. Hence a manipulated vector is exactly as large as its data and
+   * trivially copyable.
+   *
+   * Properties only convert from and to real_t; assigning one property to
+   * another of the same type copies nothing.
+   */
+
   class NoManipulator {
   public:
-    NoManipulator(real_t *) noexcept
-    {
-    }
+    NoManipulator() noexcept = default;
 
     ~NoManipulator() noexcept = default;
 
-  private:
-    NoManipulator() noexcept = delete;
+  protected:
+    real_t _data[4];
   };
 
   template<size_t index>
   class VectorProperty {
   public:
-    VectorProperty(real_t *base) noexcept
-      : _data(base + index)
-    {
-    }
+    VectorProperty() noexcept = default;
 
     ~VectorProperty() noexcept = default;
 
     inline operator real_t() const
     {
-      return *_data;
+      return data()[index];
     }
 
     inline real_t operator=(const real_t value)
     {
-      *_data = value;
-      return *_data;
+      data()[index] = value;
+      return data()[index];
     }
 
     inline real_t operator+=(const real_t value)
     {
-      *_data += value;
-      return *_data;
+      data()[index] += value;
+      return data()[index];
     }
 
     inline real_t operator-=(const real_t value)
     {
-      *_data -= value;
-      return *_data;
+      data()[index] -= value;
+      return data()[index];
     }
 
     inline real_t operator*=(const real_t value)
     {
-      *_data *= value;
-      return *_data;
+      data()[index] *= value;
+      return data()[index];
     }
 
     inline real_t operator/=(const real_t value)
     {
-      *_data /= value;
-      return *_data;
+      data()[index] /= value;
+      return data()[index];
     }
 
   private:
-    VectorProperty() noexcept = delete;
+    inline const real_t *data() const
+    {
+      return reinterpret_cast<const real_t*>(this);
+    }
 
-    real_t *_data{nullptr};
+    inline real_t *data()
+    {
+      return reinterpret_cast<real_t*>(this);
+    }
   };
 
 } // namespace n4
@@ -38,21 +38,17 @@ namespace n4 {
 
   class Normal3fManipulator {
   public:
-    Normal3fManipulator(real_t *data) noexcept
-      : x(data)
-      , y(data)
-      , z(data)
-    {
-    }
+    Normal3fManipulator() noexcept = default;
 
     ~Normal3fManipulator() noexcept = default;
 
-    VectorProperty<0> x;
-    VectorProperty<1> y;
-    VectorProperty<2> z;
+    union {
+      real_t _data[4];
 
-  private:
-    Normal3fManipulator() noexcept = delete;
+      VectorProperty<0> x;
+      VectorProperty<1> y;
+      VectorProperty<2> z;
+    };
   };
 
   struct Normal3fTraits {
@@ -61,6 +57,8 @@ namespace n4 {
 
   using Normal3f = Vector4f<Normal3fTraits,Normal3fManipulator>;
 
+  static_assert(sizeof(Normal3f) == 16  &&  std::is_trivially_copyable_v<Normal3f>);
+
 } // namespace n4
 
 #endif // N4_NORMAL3F_H
@@ -0,0 +1,294 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef N4_QBVH_H
+#define N4_QBVH_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <vector>
+
+#include <N4/BVH.h>
+#include <N4/SIMD.h>
+#include <N4/Triangle.h>
+#include <N4/Vertex4f.h>
+
+namespace n4 {
+
+  ////// Types ///////////////////////////////////////////////////////////////
+
+  /*
+   * NOTE:
+   * The four child boxes are stored in structure-of-arrays layout; e.g.
+   * bbMin[0] holds the minimum x of all children. A child with count > 0
+   * is a leaf referencing a block of four triangles, else it is an inner
+   * node. Unused children are Empty.
+   */
+  struct alignas(64) QBVHNode {
+    static constexpr std::uint32_t Empty = std::numeric_limits<std::uint32_t>::max();
+
+    real_t        bbMin[3][4];
+    real_t        bbMax[3][4];
+    std::uint32_t child[4];
+    std::uint32_t count[4];
+  };
+
+  static_assert(sizeof(QBVHNode) == 128);
+
+  ////// Four-Wide Bounding Volume Hierarchy /////////////////////////////////
+
+  class QBVH {
+  public:
+    /*
+     * NOTE:
+     * Every level pops one entry and pushes at most four children; i.e. the
+     * stack grows by at most three per level. A QBVH is at most as deep as
+     * the binary BVH it was collapsed from.
+     */
+    static constexpr std::size_t StackSize = 3*impl::BVHBuilder::MaxDepth + 1;
+
+    QBVH() noexcept = default;
+
+    ~QBVH() noexcept = default;
+
+    /*
+     * NOTE:
+     * Collapses a binary BVH; every node adopts the children of its largest
+     * inner children until it has four. The leaves are shared unchanged.
+     */
+    void build(const BVH& bvh)
+    {
+      _nodes.clear();
+      _triangles = bvh.triangles();
+      _ids       = bvh.triangleIds();
+      if( bvh.nodes().empty() ) {
+        return;
+      }
+
+      collapse(bvh.nodes(), 0);
+    }
+
+    void build(const Vertex4f *vertices, const std::uint32_t *indices,
+               const std::size_t triangleCount, const std::size_t threadCount = 0)
+    {
+      BVH bvh;
+      bvh.build(vertices, indices, triangleCount, threadCount);
+      build(bvh);
+    }
+
+    // NOTE: cf. BVH::intersect()
+    template<bool WATERTIGHT = false, typename Direction>
+    bool intersect(const Vertex4f& org, const Direction& dir, BVHHit& hit,
+                   const real_t tMin = 0,
+                   real_t tMax = std::numeric_limits<real_t>::infinity()) const
+    {
+      return traverse<WATERTIGHT,false>(org.eval(), dir.eval(), hit, tMin, tMax);
+    }
+
+    // NOTE: cf. BVH::occluded()
+    template<bool WATERTIGHT = false, typename Direction>
+    bool occluded(const Vertex4f& org, const Direction& dir,
+                  const real_t tMin = 0,
+                  const real_t tMax = std::numeric_limits<real_t>::infinity()) const
+    {
+      BVHHit hit;
+      return traverse<WATERTIGHT,true>(org.eval(), dir.eval(), hit, tMin, tMax);
+    }
+
+    inline const std::vector<QBVHNode>& nodes() const
+    {
+      return _nodes;
+    }
+
+    inline const std::vector<simd::Triangle4>& triangles() const
+    {
+      return _triangles;
+    }
+
+    inline const std::vector<std::uint32_t>& triangleIds() const
+    {
+      return _ids;
+    }
+
+  private:
+    struct StackEntry {
+      std::uint32_t child;
+      std::uint32_t count;
+      real_t        tNear;
+    };
+
+    template<bool WATERTIGHT, bool ANY_HIT>
+    bool traverse(const simd::simd_t& org, const simd::simd_t& dir, BVHHit& hit,
+                  const real_t tMin, real_t tMax) const
+    {
+      if( _nodes.empty() ) {
+        return false;
+      }
+
+      alignas(16) real_t o[4], d[4];
+      simd::store(o, org);
+      simd::store(d, simd::inverseDirection(dir));
+
+      const simd::simd_t    org4[3] = { simd::set(o[0]), simd::set(o[1]), simd::set(o[2]) };
+      const simd::simd_t invDir4[3] = { simd::set(d[0]), simd::set(d[1]), simd::set(d[2]) };
+      const simd::simd_t    tMin4   = simd::set(tMin);
+
+      StackEntry stack[StackSize];
+      std::size_t top = 0;
+      stack[top++] = {0, 0, tMin};
+
+      bool found = false;
+      while( top > 0 ) {
+        const StackEntry entry = stack[--top];
+        if( entry.tNear > tMax ) {
+          continue;
+        }
+
+        if( entry.count > 0 ) {
+          if( impl::bvhLeaf<WATERTIGHT,ANY_HIT>(_triangles[entry.child], &_ids[4*entry.child],
+                                                entry.count, org, dir, tMin, tMax, hit) ) {
+            if constexpr( ANY_HIT ) {
+              return true;
+            }
+            found = true;
+          }
+          continue;
+        }
+
+        const QBVHNode& node = _nodes[entry.child];
+
+        const simd::simd_t bbMin[3] = {
+          simd::load(node.bbMin[0]), simd::load(node.bbMin[1]), simd::load(node.bbMin[2])
+        };
+        const simd::simd_t bbMax[3] = {
+          simd::load(node.bbMax[0]), simd::load(node.bbMax[1]), simd::load(node.bbMax[2])
+        };
+
+        simd::simd_t tNear4;
+        const int mask = simd::intersectRayAABBox4(bbMin, bbMax, org4, invDir4,
+                                                   tMin4, simd::set(tMax), tNear4);
+        if( mask == 0 ) {
+          continue;
+        }
+
+        alignas(16) real_t tNear[4];
+        simd::store(tNear, tNear4);
+
+        // NOTE: Push far to near; i.e. the nearest child is visited next.
+        const std::size_t base = top;
+        for(std::size_t l = 0; l < 4; l++) {
+          if( (mask & (1 << l)) == 0  ||  node.child[l] == QBVHNode::Empty ) {
+            continue;
+          }
+          std::size_t i = top++;
+          for(; i > base  &&  stack[i - 1].tNear < tNear[l]; i--) {
+            stack[i] = stack[i - 1];
+          }
+          stack[i] = {node.child[l], node.count[l], tNear[l]};
+        }
+      }
+
+      return found;
+    }
+
+    inline static real_t area(const BVHNode& node)
+    {
+      const real_t dx = node.bbMax[0] - node.bbMin[0];
+      const real_t dy = node.bbMax[1] - node.bbMin[1];
+      const real_t dz = node.bbMax[2] - node.bbMin[2];
+      return dx*dy + dy*dz + dz*dx;
+    }
+
+    std::uint32_t collapse(const std::vector<BVHNode>& binary, const std::uint32_t root)
+    {
+      const std::uint32_t index = static_cast<std::uint32_t>(_nodes.size());
+      _nodes.emplace_back();
+
+      // (1) Adopt the children of the largest inner child. //////////////////
+
+      std::uint32_t slots[4] = {root};
+      std::size_t   count = 1;
+      while( count < 4 ) {
+        std::size_t largest = count;
+        for(std::size_t l = 0; l < count; l++) {
+          if( !binary[slots[l]].isLeaf()  &&
+              (largest == count  ||  area(binary[slots[l]]) > area(binary[slots[largest]])) ) {
+            largest = l;
+          }
+        }
+        if( largest == count ) {
+          break;
+        }
+
+        const std::uint32_t inner = slots[largest];
+        slots[largest] = inner + 1;
+        slots[count++] = binary[inner].index;
+      }
+
+      // (2) Emit the children; NOTE: _nodes may grow. ///////////////////////
+
+      for(std::size_t l = 0; l < 4; l++) {
+        if( l >= count ) {
+          for(std::size_t k = 0; k < 3; k++) {
+            _nodes[index].bbMin[k][l] = 0;
+            _nodes[index].bbMax[k][l] = 0;
+          }
+          _nodes[index].child[l] = QBVHNode::Empty;
+          _nodes[index].count[l] = 0;
+          continue;
+        }
+
+        const BVHNode& node = binary[slots[l]];
+        for(std::size_t k = 0; k < 3; k++) {
+          _nodes[index].bbMin[k][l] = node.bbMin[k];
+          _nodes[index].bbMax[k][l] = node.bbMax[k];
+        }
+
+        const std::uint32_t child = node.isLeaf()
+            ? node.index
+            : collapse(binary, slots[l]);
+        _nodes[index].child[l] = child;
+        _nodes[index].count[l] = node.count;
+      }
+
+      return index;
+    }
+
+    std::vector<QBVHNode>        _nodes;
+    std::vector<simd::Triangle4> _triangles;
+    std::vector<std::uint32_t>   _ids;
+  };
+
+} // namespace n4
+
+#endif // N4_QBVH_H
@@ -0,0 +1,292 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef N4_QUATERNION4F_H
+#define N4_QUATERNION4F_H
+
+#include <cs/NumericArray.h>
+#include <N4/Math.h>
+#include <N4/Matrix4f.h>
+#include <N4/SIMD.h>
+#include <N4/Vector4f.h>
+
+namespace n4 {
+
+  ////// Quaternion - Implementation /////////////////////////////////////////
+
+  /*
+   * NOTE:
+   * A quaternion is stored as [ x y z w ], where w is the real part. Unit
+   * quaternions represent rotations; composing two rotations q2*q1 costs 16
+   * multiplications compared to 27 for a 3x3 matrix product.
+   */
+
+  class alignas(sizeof(simd::simd_t)) Quaternion4f {
+  public:
+    ////// Destructor ////////////////////////////////////////////////////////
+
+    ~Quaternion4f() noexcept = default;
+
+    ////// Constructor ///////////////////////////////////////////////////////
+
+    Quaternion4f() noexcept
+    {
+      simd::store(_data, simd::set(0, 0, 0, 1));
+    }
+
+    Quaternion4f(const real_t x, const real_t y, const real_t z, const real_t w) noexcept
+    {
+      simd::store(_data, simd::set(x, y, z, w));
+    }
+
+    explicit Quaternion4f(const simd::simd_t& q) noexcept
+    {
+      simd::store(_data, q);
+    }
+
+    ////// Copy //////////////////////////////////////////////////////////////
+
+    Quaternion4f(const Quaternion4f&) noexcept = default;
+
+    Quaternion4f& operator=(const Quaternion4f&) noexcept = default;
+
+    ////// Move //////////////////////////////////////////////////////////////
+
+    Quaternion4f(Quaternion4f&&) noexcept = default;
+
+    Quaternion4f& operator=(Quaternion4f&&) noexcept = default;
+
+    ////// Conversion ////////////////////////////////////////////////////////
+
+    /*
+     * NOTE: The axis is required to be of unit length.
+     */
+    template<typename VecT>
+    inline static Quaternion4f fromAxisAngle(const VecT& axis, const real_t radians)
+    {
+      const real_t s = n4::sin(radians/2);
+      return Quaternion4f(axis(0)*s, axis(1)*s, axis(2)*s, n4::cos(radians/2));
+    }
+
+    inline static Quaternion4f fromMatrix(const Matrix4f& M)
+    {
+      return fromRotation(M(0, 0), M(0, 1), M(0, 2),
+                          M(1, 0), M(1, 1), M(1, 2),
+                          M(2, 0), M(2, 1), M(2, 2));
+    }
+
+    template<typename traits_T, typename ARG>
+    inline static Quaternion4f fromMatrix(const cs::ExprBase<traits_T,ARG>& expr)
+    {
+      static_assert(cs::if_dimensions_v<traits_T,3,3>);
+      const ARG& M = expr.as_derived();
+      return fromRotation(real_t(M.template eval<0,0>()), real_t(M.template eval<0,1>()), real_t(M.template eval<0,2>()),
+                          real_t(M.template eval<1,0>()), real_t(M.template eval<1,1>()), real_t(M.template eval<1,2>()),
+                          real_t(M.template eval<2,0>()), real_t(M.template eval<2,1>()), real_t(M.template eval<2,2>()));
+    }
+
+    inline Matrix4f toMatrix4f() const
+    {
+      const real_t x = _data[0], y = _data[1], z = _data[2], w = _data[3];
+      return Matrix4f{
+        1 - 2*(y*y + z*z),     2*(x*y - z*w),     2*(x*z + y*w), 0,
+            2*(x*y + z*w), 1 - 2*(x*x + z*z),     2*(y*z - x*w), 0,
+            2*(x*z - y*w),     2*(y*z + x*w), 1 - 2*(x*x + y*y), 0,
+                        0,                 0,                 0, 1
+      };
+    }
+
+    template<typename T>
+    inline cs::NumericArray<T,3,3> toMatrix3x3() const
+    {
+      const T x = _data[0], y = _data[1], z = _data[2], w = _data[3];
+      return cs::NumericArray<T,3,3>{
+        1 - 2*(y*y + z*z),     2*(x*y - z*w),     2*(x*z + y*w),
+            2*(x*y + z*w), 1 - 2*(x*x + z*z),     2*(y*z - x*w),
+            2*(x*z - y*w),     2*(y*z + x*w), 1 - 2*(x*x + y*y)
+      };
+    }
+
+    inline simd::simd_t eval() const
+    {
+      return simd::load(_data);
+    }
+
+    ////// Data Access ///////////////////////////////////////////////////////
+
+    inline const real_t *data() const
+    {
+      return _data;
+    }
+
+    inline real_t *data()
+    {
+      return _data;
+    }
+
+    ////// Element Access ////////////////////////////////////////////////////
+
+    constexpr size_t size() const
+    {
+      return 4;
+    }
+
+    inline real_t operator()(const size_t i) const
+    {
+      return _data[i];
+    }
+
+    inline real_t& operator()(const size_t i)
+    {
+      return _data[i];
+    }
+
+    ////// Functions /////////////////////////////////////////////////////////
+
+    inline Quaternion4f conjugate() const
+    {
+      return Quaternion4f(simd::qconj(eval()));
+    }
+
+    inline Quaternion4f inverse() const
+    {
+      const simd::simd_t q = eval();
+      return Quaternion4f(simd::div(simd::qconj(q), simd::qdot(q, q)));
+    }
+
+    inline real_t length() const
+    {
+      const simd::simd_t q = eval();
+      return simd::to_real(simd::sqrt(simd::qdot(q, q)));
+    }
+
+    inline Quaternion4f normalize() const
+    {
+      const simd::simd_t q = eval();
+      return Quaternion4f(simd::div(q, simd::sqrt(simd::qdot(q, q))));
+    }
+
+    /*
+     * NOTE: Requires a unit quaternion.
+     */
+    template<typename traits_T, typename manip_T>
+    inline Vector4f<traits_T,manip_T> rotate(const Vector4f<traits_T,manip_T>& v) const
+    {
+      Vector4f<traits_T,manip_T> result;
+      simd::store(result.data(), simd::qrotate(eval(), v.eval()));
+      return result;
+    }
+
+  private:
+    /*
+     * NOTE:
+     * Shepperd's method; the largest of the four candidates for |x|, |y|,
+     * |z| and |w| is computed from the diagonal to avoid cancellation.
+     */
+    inline static Quaternion4f fromRotation(const real_t m00, const real_t m01, const real_t m02,
+                                            const real_t m10, const real_t m11, const real_t m12,
+                                            const real_t m20, const real_t m21, const real_t m22)
+    {
+      const real_t trace = m00 + m11 + m22;
+      if(        trace > 0 ) {
+        const real_t s = 2*n4::sqrt(1 + trace);
+        return Quaternion4f((m21 - m12)/s, (m02 - m20)/s, (m10 - m01)/s, s/4);
+      } else if( m00 > m11  &&  m00 > m22 ) {
+        const real_t s = 2*n4::sqrt(1 + m00 - m11 - m22);
+        return Quaternion4f(s/4, (m01 + m10)/s, (m02 + m20)/s, (m21 - m12)/s);
+      } else if( m11 > m22 ) {
+        const real_t s = 2*n4::sqrt(1 + m11 - m00 - m22);
+        return Quaternion4f((m01 + m10)/s, s/4, (m12 + m21)/s, (m02 - m20)/s);
+      }
+      const real_t s = 2*n4::sqrt(1 + m22 - m00 - m11);
+      return Quaternion4f((m02 + m20)/s, (m12 + m21)/s, s/4, (m10 - m01)/s);
+    }
+
+    real_t _data[4];
+  };
+
+  static_assert(sizeof(Quaternion4f) == 16  &&  std::is_trivially_copyable_v<Quaternion4f>);
+
+  ////// Quaternion - Binary Operators ///////////////////////////////////////
+
+  inline Quaternion4f operator*(const Quaternion4f& lhs, const Quaternion4f& rhs)
+  {
+    return Quaternion4f(simd::qmul(lhs.eval(), rhs.eval()));
+  }
+
+  ////// Quaternion - Functions //////////////////////////////////////////////
+
+  inline real_t dot(const Quaternion4f& a, const Quaternion4f& b)
+  {
+    return simd::to_real(simd::qdot(a.eval(), b.eval()));
+  }
+
+  /*
+   * NOTE:
+   * Both nlerp() and slerp() interpolate along the shorter arc; i.e. b is
+   * negated if the angle between a and b exceeds 90 degrees.
+   */
+
+  inline Quaternion4f nlerp(const Quaternion4f& a, const Quaternion4f& b, const real_t t)
+  {
+    const real_t wb = dot(a, b) < 0
+        ? -t
+        :  t;
+    const simd::simd_t q = simd::fmadd(simd::set(wb), b.eval(),
+                                       simd::mul(simd::set(1 - t), a.eval()));
+    return Quaternion4f(simd::div(q, simd::sqrt(simd::qdot(q, q))));
+  }
+
+  /*
+   * NOTE:
+   * Nearly parallel quaternions fall back to nlerp(), where sin(theta)
+   * vanishes.
+   */
+  inline Quaternion4f slerp(const Quaternion4f& a, const Quaternion4f& b, const real_t t)
+  {
+    const real_t d = dot(a, b);
+    const real_t c = n4::abs(d);
+    if( c > 1 - EPSILON0_VECTOR ) {
+      return nlerp(a, b, t);
+    }
+
+    const real_t theta = n4::acos(c);
+    const real_t     s = n4::sin(theta);
+    const real_t    wa = n4::sin((1 - t)*theta)/s;
+    const real_t    wb = n4::sin(t*theta)/s;
+
+    return Quaternion4f(simd::fmadd(simd::set(d < 0 ? -wb : wb), b.eval(),
+                                    simd::mul(simd::set(wa), a.eval())));
+  }
+
+} // namespace n4
+
+#endif // N4_QUATERNION4F_H
@@ -0,0 +1,151 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef N4_RAYPACKET_H
+#define N4_RAYPACKET_H
+
+#include <cstddef>
+
+#include <limits>
+
+#include <cs/impl/TargetImpl.h>
+#include <cs/SIMD.h>
+#include <N4/SIMD.h>
+
+namespace simd {
+
+  ////// Ray Packet //////////////////////////////////////////////////////////
+
+  /*
+   * NOTE:
+   * A packet holds WIDTH rays in structure-of-arrays layout; i.e. lane l of
+   * every member belongs to ray l. Hence one register holds the same
+   * coordinate of all rays and no lane is wasted.
+   */
+  template<std::size_t WIDTH>
+  struct alignas(WIDTH*sizeof(real_t)) RayPacket {
+    static constexpr std::size_t Width = WIDTH;
+
+    real_t    org[3][WIDTH];
+    real_t    dir[3][WIDTH];
+    real_t invDir[3][WIDTH];
+    real_t   tMin[WIDTH];
+    real_t   tMax[WIDTH];
+
+    inline void set(const std::size_t l, const real_t *o, const real_t *d,
+                    const real_t t0 = 0,
+                    const real_t t1 = std::numeric_limits<real_t>::infinity())
+    {
+      for(std::size_t k = 0; k < 3; k++) {
+        org[k][l]    = o[k];
+        dir[k][l]    = d[k];
+        invDir[k][l] = real_t(1)/d[k];
+      }
+      tMin[l] = t0;
+      tMax[l] = t1;
+    }
+  };
+
+  using RayPacket4  = RayPacket<4>;
+  using RayPacket8  = RayPacket<8>;
+  using RayPacket16 = RayPacket<16>;
+
+} // namespace simd
+
+////// Packet Kernels - SSE2 /////////////////////////////////////////////////
+
+#define N4_PACKET_NAMESPACE  sse2
+#define N4_PACKET_SIMD       SIMD128
+#include <N4/RayPacketImpl.h>
+#undef N4_PACKET_NAMESPACE
+#undef N4_PACKET_SIMD
+
+////// Packet Kernels - AVX2 /////////////////////////////////////////////////
+
+CS_TARGET_PUSH("avx2,fma")
+#define N4_PACKET_NAMESPACE  avx2
+#define N4_PACKET_SIMD       SIMD256
+#include <N4/RayPacketImpl.h>
+#undef N4_PACKET_NAMESPACE
+#undef N4_PACKET_SIMD
+CS_TARGET_POP()
+
+////// Packet Kernels - AVX-512 //////////////////////////////////////////////
+
+CS_TARGET_PUSH("avx512f,avx2,fma")
+#define N4_PACKET_NAMESPACE  avx512
+#define N4_PACKET_SIMD       SIMD512
+#include <N4/RayPacketImpl.h>
+#undef N4_PACKET_NAMESPACE
+#undef N4_PACKET_SIMD
+CS_TARGET_POP()
+
+namespace simd {
+
+  namespace packet {
+
+    template<std::size_t WIDTH>
+    struct Select {
+      static_assert(WIDTH == 4);
+      using kernels = sse2::Kernels;
+    };
+
+    template<>
+    struct Select<8> {
+      using kernels = avx2::Kernels;
+    };
+
+    template<>
+    struct Select<16> {
+      using kernels = avx512::Kernels;
+    };
+
+  } // namespace packet
+
+  ////// User Interface //////////////////////////////////////////////////////
+
+  /*
+   * NOTE:
+   * Returns a mask with bit l set if ray l hits the box within its
+   * [tMin, tMax]; tNear and tFar receive all WIDTH entry and exit distances.
+   * Packets of 8 (16) rays require AVX2 (AVX-512), cf. cs::cpuISA().
+   */
+  template<std::size_t WIDTH>
+  inline int intersectRayPacketAABBox(const RayPacket<WIDTH>& rays,
+                                      const real_t *bbMin, const real_t *bbMax,
+                                      real_t *tNear, real_t *tFar)
+  {
+    return packet::Select<WIDTH>::kernels::intersectAABBox(rays, bbMin, bbMax, tNear, tFar);
+  }
+
+} // namespace simd
+
+#endif // N4_RAYPACKET_H
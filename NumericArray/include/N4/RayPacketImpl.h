@@ -0,0 +1,83 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * NOTE:
+ * This file is intentionally NOT guarded against multiple inclusion!
+ * N4/RayPacket.h includes it once per ISA after defining N4_PACKET_NAMESPACE
+ * and N4_PACKET_SIMD, and within the matching CS_TARGET_PUSH() region.
+ */
+
+#if !defined(N4_PACKET_NAMESPACE)  ||  !defined(N4_PACKET_SIMD)
+# error "Do not include RayPacketImpl.h directly; include N4/RayPacket.h!"
+#endif
+
+namespace simd {
+
+  namespace packet {
+
+    namespace N4_PACKET_NAMESPACE {
+
+      struct Kernels {
+        using     backend = cs::N4_PACKET_SIMD<real_t>;
+        using   simd_type = typename backend::simd_type;
+        using packet_type = RayPacket<backend::ElementCount>;
+
+        /*
+         * NOTE:
+         * Slab test; the result is unspecified for a ray lying in the plane
+         * of a slab, where 0*inf yields NaN.
+         */
+        static int intersectAABBox(const packet_type& rays,
+                                   const real_t *bbMin, const real_t *bbMax,
+                                   real_t *tNear, real_t *tFar)
+        {
+          simd_type t0 = backend::load(rays.tMin);
+          simd_type t1 = backend::load(rays.tMax);
+          for(std::size_t k = 0; k < 3; k++) {
+            const simd_type org = backend::load(rays.org[k]);
+            const simd_type inv = backend::load(rays.invDir[k]);
+            const simd_type tlo = backend::mul(backend::sub(backend::set(bbMin[k]), org), inv);
+            const simd_type thi = backend::mul(backend::sub(backend::set(bbMax[k]), org), inv);
+            t0 = backend::max(backend::min(tlo, thi), t0);
+            t1 = backend::min(backend::max(tlo, thi), t1);
+          }
+          backend::storeu(tNear, t0);
+          backend::storeu(tFar, t1);
+          return backend::movemask(backend::cmple(t0, t1));
+        }
+      };
+
+    } // namespace N4_PACKET_NAMESPACE
+
+  } // namespace packet
+
+} // namespace simd
@@ -34,6 +34,10 @@
 
 #include <emmintrin.h> // SSE2
 
+#if defined(__FMA__)
+# include <immintrin.h> // FMA
+#endif
+
 namespace simd {
 
   ////// Types ///////////////////////////////////////////////////////////////
@@ -142,6 +146,15 @@ namespace simd {
     return _mm_div_ps(a, b);
   }
 
+  inline simd_t fmadd(const simd_t& a, const simd_t& b, const simd_t& c)
+  {
+#if defined(__FMA__)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+  }
+
   inline simd_t hadd(const simd_t& x)
   {
     const simd_t y = _mm_add_ps(x, SIMD_SWIZZLE(x, 1, 0, 3, 2));
@@ -393,9 +406,9 @@ namespace simd {
   {
     // NOTE: y = M*x
     simd_t y = mul(SIMD_SWIZZLE(x, 0, 0, 0, 0), col0);
-    y = add(y, mul(SIMD_SWIZZLE(x, 1, 1, 1, 1), col1));
-    y = add(y, mul(SIMD_SWIZZLE(x, 2, 2, 2, 2), col2));
-    y = add(y, mul(SIMD_SWIZZLE(x, 3, 3, 3, 3), col3));
+    y = fmadd(SIMD_SWIZZLE(x, 1, 1, 1, 1), col1, y);
+    y = fmadd(SIMD_SWIZZLE(x, 2, 2, 2, 2), col2, y);
+    y = fmadd(SIMD_SWIZZLE(x, 3, 3, 3, 3), col3, y);
     return y;
   }
 
@@ -424,6 +437,54 @@ namespace simd {
     simd::store(dest + 12, col3);
   }
 
+  ////// Quaternion Functions ////////////////////////////////////////////////
+
+  /*
+   * Quaternions are stored as [ x y z w ], where w is the real part.
+   */
+
+  inline simd_t qconj(const simd_t& q)
+  {
+    return bit_xor(q, set(-0.0f, -0.0f, -0.0f, 0.0f));
+  }
+
+  inline simd_t qdot(const simd_t& a, const simd_t& b)
+  {
+    return hadd(mul(a, b));
+  }
+
+  /*
+   *         [ aw*bx + ax*bw + ay*bz - az*by ]
+   * a * b = [ aw*by + ay*bw + az*bx - ax*bz ]
+   *         [ aw*bz + az*bw + ax*by - ay*bx ]
+   *         [ aw*bw - ax*bx - ay*by - az*bz ]
+   */
+  inline simd_t qmul(const simd_t& a, const simd_t& b)
+  {
+    const simd_t signW = set(0.0f, 0.0f, 0.0f, -0.0f);
+
+    const simd_t prod1 = mul(SIMD_SWIZZLE(a, 3, 3, 3, 3), b);
+    const simd_t prod2 = mul(SIMD_SWIZZLE(a, 0, 1, 2, 0), SIMD_SWIZZLE(b, 3, 3, 3, 0));
+    const simd_t prod3 = mul(SIMD_SWIZZLE(a, 1, 2, 0, 1), SIMD_SWIZZLE(b, 2, 0, 1, 1));
+    const simd_t prod4 = mul(SIMD_SWIZZLE(a, 2, 0, 1, 2), SIMD_SWIZZLE(b, 1, 2, 0, 2));
+
+    return sub(add(prod1, bit_xor(add(prod2, prod3), signW)), prod4);
+  }
+
+  /*
+   * Rotate v by the unit quaternion q, i.e. q * v * conj(q):
+   *
+   * t  = 2*(q.xyz X v)
+   * v' = v + q.w*t + q.xyz X t
+   *
+   * NOTE: The w component of v is preserved.
+   */
+  inline simd_t qrotate(const simd_t& q, const simd_t& v)
+  {
+    const simd_t t = mul(set(2), cross(q, v));
+    return add(fmadd(SIMD_SWIZZLE(q, 3, 3, 3, 3), t, v), cross(q, t));
+  }
+
   ////// Ray Axis Aligned Bounding Box Intersection //////////////////////////
 
   inline bool intersectRayAABBox(const simd_t& bbMin, const simd_t& bbMax,
@@ -471,6 +532,74 @@ namespace simd {
     return (result & result_mask) == result_mask;
   }
 
+  /*
+   * NOTE:
+   * Components of the direction smaller than 1e-20 are replaced by 1e-20
+   * (keeping their sign) before inverting. Hence the slab tests below never
+   * compute 0*inf, which yields NaN for rays in the plane of a slab.
+   */
+  inline simd_t inverseDirection(const simd_t& rayDir)
+  {
+    const simd_t tiny = set(1e-20f);
+    const simd_t sign = bit_and(rayDir, set(-0.0f));
+    return div(set(1), bit_or(max(abs(rayDir), tiny), sign));
+  }
+
+  /*
+   * NOTE:
+   * Slab test computing the interval [max(tNear), min(tFar)] of all three
+   * axes clipped to [rayMin, rayMax]; rayInvDir is cf. inverseDirection().
+   * Returns true if the interval is not empty; tNear receives the entry
+   * distance, e.g. to visit the children of a BVH front to back. The w
+   * components of bbMin and bbMax are ignored.
+   */
+  inline bool intersectRayAABBox(const simd_t& bbMin, const simd_t& bbMax,
+                                 const simd_t& rayOrg, const simd_t& rayInvDir,
+                                 const real_t rayMin, const real_t rayMax,
+                                 real_t& tNear)
+  {
+    const simd_t W = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+    const simd_t tlo = mul(sub(bbMin, rayOrg), rayInvDir);
+    const simd_t thi = mul(sub(bbMax, rayOrg), rayInvDir);
+
+    simd_t t0 = cmov(W, set(rayMin), min(tlo, thi));
+    simd_t t1 = cmov(W, set(rayMax), max(tlo, thi));
+
+    t0 = max(t0, SIMD_SWIZZLE(t0, 2, 3, 0, 1));
+    t0 = max(t0, SIMD_SWIZZLE(t0, 1, 0, 3, 2));
+    t1 = min(t1, SIMD_SWIZZLE(t1, 2, 3, 0, 1));
+    t1 = min(t1, SIMD_SWIZZLE(t1, 1, 0, 3, 2));
+
+    tNear = to_real(t0);
+    return tNear <= to_real(t1);
+  }
+
+  /*
+   * NOTE:
+   * Slab test of one ray against four boxes in structure-of-arrays layout;
+   * e.g. bbMin[0] holds the minimum x of all four boxes. The ray's origin
+   * and inverse direction are broadcast to all lanes. Returns a mask with
+   * bit l set if box l is hit within [rayMin, rayMax]; tNear receives the
+   * entry distances.
+   */
+  inline int intersectRayAABBox4(const simd_t *bbMin, const simd_t *bbMax,
+                                 const simd_t *rayOrg, const simd_t *rayInvDir,
+                                 const simd_t& rayMin, const simd_t& rayMax,
+                                 simd_t& tNear)
+  {
+    simd_t t0 = rayMin;
+    simd_t t1 = rayMax;
+    for(int k = 0; k < 3; k++) {
+      const simd_t tlo = mul(sub(bbMin[k], rayOrg[k]), rayInvDir[k]);
+      const simd_t thi = mul(sub(bbMax[k], rayOrg[k]), rayInvDir[k]);
+      t0 = max(t0, min(tlo, thi));
+      t1 = min(t1, max(tlo, thi));
+    }
+    tNear = t0;
+    return cmpMask(cmpLEQ(t0, t1));
+  }
+
 } // namespace simd
 
 #endif // N4_SIMD_H
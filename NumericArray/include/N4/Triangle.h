@@ -0,0 +1,311 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef N4_TRIANGLE_H
+#define N4_TRIANGLE_H
+
+#include <cmath>
+#include <cstddef>
+
+#include <utility>
+
+#include <N4/RayPacket.h>
+#include <N4/SIMD.h>
+
+namespace simd {
+
+  ////// Triangle Packet /////////////////////////////////////////////////////
+
+  /*
+   * NOTE:
+   * Four triangles in structure-of-arrays layout; cf. RayPacket. The vertices
+   * rather than the edges are stored, as the watertight test requires them.
+   */
+  struct alignas(16) Triangle4 {
+    real_t v0[3][4];
+    real_t v1[3][4];
+    real_t v2[3][4];
+
+    inline void set(const std::size_t l,
+                    const real_t *p0, const real_t *p1, const real_t *p2)
+    {
+      for(std::size_t k = 0; k < 3; k++) {
+        v0[k][l] = p0[k];
+        v1[k][l] = p1[k];
+        v2[k][l] = p2[k];
+      }
+    }
+  };
+
+  struct alignas(16) TriangleHit4 {
+    real_t t[4];
+    real_t u[4];
+    real_t v[4];
+  };
+
+  ////// Implementation //////////////////////////////////////////////////////
+
+  namespace impl {
+
+    /*
+     * NOTE:
+     * Every simd_t holds the same coordinate of four lanes; e.g. a[0] are
+     * the x coordinates of four vectors.
+     */
+
+    inline void cross3x4(simd_t *r, const simd_t *a, const simd_t *b)
+    {
+      r[0] = sub(mul(a[1], b[2]), mul(a[2], b[1]));
+      r[1] = sub(mul(a[2], b[0]), mul(a[0], b[2]));
+      r[2] = sub(mul(a[0], b[1]), mul(a[1], b[0]));
+    }
+
+    inline simd_t dot3x4(const simd_t *a, const simd_t *b)
+    {
+      return add(add(mul(a[0], b[0]), mul(a[1], b[1])), mul(a[2], b[2]));
+    }
+
+    inline void sub3x4(simd_t *r, const simd_t *a, const simd_t *b)
+    {
+      r[0] = sub(a[0], b[0]);
+      r[1] = sub(a[1], b[1]);
+      r[2] = sub(a[2], b[2]);
+    }
+
+    inline int storeHit(TriangleHit4& hit, const simd_t& valid,
+                        const simd_t& t, const simd_t& u, const simd_t& v,
+                        const simd_t& tMin, const simd_t& tMax)
+    {
+      store(hit.t, t);
+      store(hit.u, u);
+      store(hit.v, v);
+      return cmpMask(bit_and(valid, bit_and(cmpLEQ(tMin, t), cmpLEQ(t, tMax))));
+    }
+
+    /*
+     * NOTE:
+     * Möller & Trumbore, "Fast, Minimum Storage Ray/Triangle Intersection",
+     * 1997. Singular (i.e. parallel) lanes are rejected by det != 0.
+     */
+    inline int intersectMT(const simd_t *org, const simd_t *dir,
+                           const simd_t *v0, const simd_t *v1, const simd_t *v2,
+                           const simd_t& tMin, const simd_t& tMax,
+                           TriangleHit4& hit)
+    {
+      simd_t e1[3], e2[3], p[3], q[3], s[3];
+
+      sub3x4(e1, v1, v0);
+      sub3x4(e2, v2, v0);
+
+      cross3x4(p, dir, e2);
+      const simd_t det = dot3x4(e1, p);
+      const simd_t inv = div(set(1), det);
+
+      sub3x4(s, org, v0);
+      const simd_t u = mul(dot3x4(s, p), inv);
+
+      cross3x4(q, s, e1);
+      const simd_t v = mul(dot3x4(dir, q), inv);
+      const simd_t t = mul(dot3x4(e2, q), inv);
+
+      const simd_t inside = bit_and(bit_and(cmpLEQ(zero(), u), cmpLEQ(zero(), v)),
+                                    cmpLEQ(add(u, v), set(1)));
+
+      return storeHit(hit, bit_and(cmpNEQ(det, zero()), inside), t, u, v, tMin, tMax);
+    }
+
+    /*
+     * NOTE:
+     * Ray-space shear & permutation of Woop, Benthin & Wald, "Watertight
+     * Ray/Triangle Intersection", JCGT 2(1), 2013: The dominant direction
+     * axis becomes z; x and y are swapped to preserve the winding.
+     */
+    struct Shear {
+      Shear(const real_t *dir) noexcept
+      {
+        kz = std::abs(dir[0]) > std::abs(dir[1])
+            ? (std::abs(dir[0]) > std::abs(dir[2]) ? 0 : 2)
+            : (std::abs(dir[1]) > std::abs(dir[2]) ? 1 : 2);
+        kx = (kz + 1)%3;
+        ky = (kx + 1)%3;
+        if( dir[kz] < 0 ) {
+          std::swap(kx, ky);
+        }
+        Sx = dir[kx]/dir[kz];
+        Sy = dir[ky]/dir[kz];
+        Sz = real_t(1)/dir[kz];
+      }
+
+      std::size_t kx{0}, ky{0}, kz{0};
+      real_t Sx{0}, Sy{0}, Sz{0};
+    };
+
+    /*
+     * NOTE:
+     * The vertices are translated to the ray's origin and permuted by Shear;
+     * the edge functions U, V, W of a hit share their sign. The double
+     * precision fallback of the paper for U, V or W equal to zero is omitted.
+     */
+    inline int intersectWT(const simd_t *A, const simd_t *B, const simd_t *C,
+                           const simd_t *S,
+                           const simd_t& tMin, const simd_t& tMax,
+                           TriangleHit4& hit)
+    {
+      const simd_t Ax = sub(A[0], mul(S[0], A[2]));
+      const simd_t Ay = sub(A[1], mul(S[1], A[2]));
+      const simd_t Bx = sub(B[0], mul(S[0], B[2]));
+      const simd_t By = sub(B[1], mul(S[1], B[2]));
+      const simd_t Cx = sub(C[0], mul(S[0], C[2]));
+      const simd_t Cy = sub(C[1], mul(S[1], C[2]));
+
+      const simd_t U = sub(mul(Cx, By), mul(Cy, Bx));
+      const simd_t V = sub(mul(Ax, Cy), mul(Ay, Cx));
+      const simd_t W = sub(mul(Bx, Ay), mul(By, Ax));
+
+      const simd_t anyNeg = bit_or(bit_or(cmpLT(U, zero()), cmpLT(V, zero())), cmpLT(W, zero()));
+      const simd_t anyPos = bit_or(bit_or(cmpGT(U, zero()), cmpGT(V, zero())), cmpGT(W, zero()));
+
+      const simd_t det = add(add(U, V), W);
+      const simd_t inv = div(set(1), det);
+
+      const simd_t T = add(add(mul(U, mul(S[2], A[2])),
+                               mul(V, mul(S[2], B[2]))),
+                           mul(W, mul(S[2], C[2])));
+
+      const simd_t valid = bit_andnot(bit_and(anyNeg, anyPos), cmpNEQ(det, zero()));
+
+      return storeHit(hit, valid, mul(T, inv), mul(V, inv), mul(W, inv), tMin, tMax);
+    }
+
+  } // namespace impl
+
+  ////// User Interface //////////////////////////////////////////////////////
+
+  /*
+   * NOTE:
+   * Intersect one ray with four triangles. Returns a mask with bit l set if
+   * triangle l is hit within [rayMin, rayMax]; hit receives the distance t
+   * and the barycentric coordinates u, v of v1 and v2 of all four lanes.
+   * Triangles are two-sided.
+   */
+  template<bool WATERTIGHT = false>
+  inline int intersectRayTriangle4(const Triangle4& tris,
+                                   const simd_t& rayOrg, const simd_t& rayDir,
+                                   const real_t rayMin, const real_t rayMax,
+                                   TriangleHit4& hit)
+  {
+    alignas(16) real_t o[4], d[4];
+    store(o, rayOrg);
+    store(d, rayDir);
+
+    const simd_t org[3] = { set(o[0]), set(o[1]), set(o[2]) };
+
+    const simd_t v0[3] = { load(tris.v0[0]), load(tris.v0[1]), load(tris.v0[2]) };
+    const simd_t v1[3] = { load(tris.v1[0]), load(tris.v1[1]), load(tris.v1[2]) };
+    const simd_t v2[3] = { load(tris.v2[0]), load(tris.v2[1]), load(tris.v2[2]) };
+
+    if constexpr( WATERTIGHT ) {
+      const impl::Shear shear(d);
+
+      simd_t a[3], b[3], c[3];
+      impl::sub3x4(a, v0, org);
+      impl::sub3x4(b, v1, org);
+      impl::sub3x4(c, v2, org);
+
+      const simd_t A[3] = { a[shear.kx], a[shear.ky], a[shear.kz] };
+      const simd_t B[3] = { b[shear.kx], b[shear.ky], b[shear.kz] };
+      const simd_t C[3] = { c[shear.kx], c[shear.ky], c[shear.kz] };
+      const simd_t S[3] = { set(shear.Sx), set(shear.Sy), set(shear.Sz) };
+
+      return impl::intersectWT(A, B, C, S, set(rayMin), set(rayMax), hit);
+    } else {
+      const simd_t dir[3] = { set(d[0]), set(d[1]), set(d[2]) };
+
+      return impl::intersectMT(org, dir, v0, v1, v2, set(rayMin), set(rayMax), hit);
+    }
+  }
+
+  /*
+   * NOTE:
+   * Intersect four rays with one triangle; cf. intersectRayTriangle4().
+   * The watertight test sets up each lane's permutation in scalar code.
+   */
+  template<bool WATERTIGHT = false>
+  inline int intersectRayPacketTriangle(const RayPacket4& rays,
+                                        const simd_t& v0, const simd_t& v1, const simd_t& v2,
+                                        TriangleHit4& hit)
+  {
+    alignas(16) real_t p0[4], p1[4], p2[4];
+    store(p0, v0);
+    store(p1, v1);
+    store(p2, v2);
+
+    const simd_t tMin = load(rays.tMin);
+    const simd_t tMax = load(rays.tMax);
+
+    if constexpr( WATERTIGHT ) {
+      alignas(16) real_t a[3][4], b[3][4], c[3][4], s[3][4];
+      for(std::size_t l = 0; l < 4; l++) {
+        const real_t d[3] = { rays.dir[0][l], rays.dir[1][l], rays.dir[2][l] };
+        const impl::Shear shear(d);
+
+        const std::size_t k[3] = { shear.kx, shear.ky, shear.kz };
+        for(std::size_t i = 0; i < 3; i++) {
+          a[i][l] = p0[k[i]] - rays.org[k[i]][l];
+          b[i][l] = p1[k[i]] - rays.org[k[i]][l];
+          c[i][l] = p2[k[i]] - rays.org[k[i]][l];
+        }
+        s[0][l] = shear.Sx;
+        s[1][l] = shear.Sy;
+        s[2][l] = shear.Sz;
+      }
+
+      const simd_t A[3] = { load(a[0]), load(a[1]), load(a[2]) };
+      const simd_t B[3] = { load(b[0]), load(b[1]), load(b[2]) };
+      const simd_t C[3] = { load(c[0]), load(c[1]), load(c[2]) };
+      const simd_t S[3] = { load(s[0]), load(s[1]), load(s[2]) };
+
+      return impl::intersectWT(A, B, C, S, tMin, tMax, hit);
+    } else {
+      const simd_t org[3] = { load(rays.org[0]), load(rays.org[1]), load(rays.org[2]) };
+      const simd_t dir[3] = { load(rays.dir[0]), load(rays.dir[1]), load(rays.dir[2]) };
+
+      const simd_t V0[3] = { set(p0[0]), set(p0[1]), set(p0[2]) };
+      const simd_t V1[3] = { set(p1[0]), set(p1[1]), set(p1[2]) };
+      const simd_t V2[3] = { set(p2[0]), set(p2[1]), set(p2[2]) };
+
+      return impl::intersectMT(org, dir, V0, V1, V2, tMin, tMax, hit);
+    }
+  }
+
+} // namespace simd
+
+#endif // N4_TRIANGLE_H
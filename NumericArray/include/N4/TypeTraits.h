@@ -82,6 +82,29 @@ namespace n4 {
     return false;
   }
 
+  ////// Fused Multiply-Add ////////////////////////////////////////////////
+
+  template<typename T, typename = bool>
+  struct is_fmadd : std::false_type {};
+
+  template<typename T>
+  struct is_fmadd<T,decltype((void)T::have_fmadd,bool())> : std::true_type {};
+
+  template<typename T>
+  inline constexpr bool is_fmadd_v = is_fmadd<T>::value;
+
+  template<typename T>
+  constexpr std::enable_if_t<is_fmadd_v<T>,bool> have_fmadd()
+  {
+    return static_cast<bool>(T::have_fmadd);
+  }
+
+  template<typename T>
+  constexpr std::enable_if_t<!is_fmadd_v<T>,bool> have_fmadd()
+  {
+    return false;
+  }
+
 } // namespace n4
 
 #endif // N4_TYPETRAITS_H
@@ -45,7 +45,7 @@ namespace n4 {
   static_assert(is_real<simd::real_t>::value);
 
   template<typename traits_T, typename manip_T = NoManipulator>
-  class Vector4f
+  class alignas(sizeof(simd::simd_t)) Vector4f
       : public ExprBase<traits_T,Vector4f<traits_T,manip_T>>
       , public manip_T {
   public:
@@ -60,7 +60,6 @@ namespace n4 {
     ////// Constructor ///////////////////////////////////////////////////////
 
     Vector4f(const real_t val = 0) noexcept
-      : manip_type(_data)
     {
       set(val);
     }
@@ -74,7 +73,6 @@ namespace n4 {
     ////// Initialize ////////////////////////////////////////////////////////
 
     Vector4f(const std::initializer_list<real_t>& list) noexcept
-      : manip_type(_data)
     {
       initialize(list);
     }
@@ -87,37 +85,20 @@ namespace n4 {
 
     ////// Copy //////////////////////////////////////////////////////////////
 
-    Vector4f(const Vector4f& other) noexcept
-      : manip_type(_data)
-    {
-      copy(other);
-    }
+    Vector4f(const Vector4f&) noexcept = default;
 
-    Vector4f& operator=(const Vector4f& other)
-    {
-      copy(other);
-      return *this;
-    }
+    Vector4f& operator=(const Vector4f&) noexcept = default;
 
     ////// Move //////////////////////////////////////////////////////////////
 
-    Vector4f(Vector4f&& other) noexcept
-      : manip_type(_data)
-    {
-      copy(other);
-    }
+    Vector4f(Vector4f&&) noexcept = default;
 
-    Vector4f& operator=(Vector4f&& other)
-    {
-      copy(other);
-      return *this;
-    }
+    Vector4f& operator=(Vector4f&&) noexcept = default;
 
     ////// Expression ////////////////////////////////////////////////////////
 
     template<typename EXPR>
     Vector4f(const ExprBase<traits_type,EXPR>& expr) noexcept
-      : manip_type(_data)
     {
       assign(expr);
     }
@@ -254,12 +235,6 @@ namespace n4 {
       }
     }
 
-    inline void copy(const Vector4f& src)
-    {
-      simd::store(_data, simd::load(src._data));
-      reset_w();
-    }
-
     inline void initialize(const std::initializer_list<real_t>& list)
     {
       if /*constexpr*/( list.size() > 0 ) {
@@ -296,7 +271,7 @@ namespace n4 {
     }
 
   private:
-    alignas(sizeof(simd::simd_t)) real_t _data[4];
+    using manip_type::_data;
   };
 
 } // namespace n4
@@ -38,23 +38,18 @@ namespace n4 {
 
   class Vertex4fManipulator {
   public:
-    Vertex4fManipulator(real_t *data) noexcept
-      : x(data)
-      , y(data)
-      , z(data)
-      , w(data)
-    {
-    }
+    Vertex4fManipulator() noexcept = default;
 
     ~Vertex4fManipulator() noexcept = default;
 
-    VectorProperty<0> x;
-    VectorProperty<1> y;
-    VectorProperty<2> z;
-    VectorProperty<3> w;
+    union {
+      real_t _data[4];
 
-  private:
-    Vertex4fManipulator() noexcept = delete;
+      VectorProperty<0> x;
+      VectorProperty<1> y;
+      VectorProperty<2> z;
+      VectorProperty<3> w;
+    };
   };
 
   struct Vertex4fTraits {
@@ -63,6 +58,8 @@ namespace n4 {
 
   using Vertex4f = Vector4f<Vertex4fTraits,Vertex4fManipulator>;
 
+  static_assert(sizeof(Vertex4f) == 16  &&  std::is_trivially_copyable_v<Vertex4f>);
+
 } // namespace n4
 
 #endif // N4_VERTEX4F_H
@@ -42,7 +42,7 @@
 namespace cs {
 
   template<typename manip_T>
-  class Array
+  class alignas(SIMD<typename manip_T::value_type>::Alignment) Array
       : public ExprBase<typename manip_T::traits_type,Array<manip_T>>
       , public manip_T {
   public:
@@ -54,48 +54,27 @@ namespace cs {
     using        simd = SIMD<value_type>;
     using   simd_type = typename simd::simd_type;
 
+    static constexpr bool is_leaf = true;
+
     static_assert(if_traits_v<traits_type>);
 
     ~Array() noexcept = default;
 
     // Copy Assignment ///////////////////////////////////////////////////////
 
-    Array(const Array& other) noexcept
-      : manip_type(_data)
-    {
-      operator=(other);
-    }
+    Array(const Array&) noexcept = default;
 
-    Array& operator=(const Array& other) noexcept
-    {
-      if( this != &other ) {
-        using COPY = impl::BlockCopy<traits_type>;
-        meta::for_each<DataBlocks,COPY>(_data, other._data);
-      }
-      return *this;
-    }
+    Array& operator=(const Array&) noexcept = default;
 
     // Move Assignment ///////////////////////////////////////////////////////
 
-    Array(Array&& other) noexcept
-      : manip_type(_data)
-    {
-      operator=(std::move(other));
-    }
+    Array(Array&&) noexcept = default;
 
-    Array& operator=(Array&& other) noexcept
-    {
-      if( this != &other ) {
-        using MOVE = impl::BlockCopy<traits_type>;
-        meta::for_each<DataBlocks,MOVE>(_data, other._data);
-      }
-      return *this;
-    }
+    Array& operator=(Array&&) noexcept = default;
 
     // Scalar Assignment /////////////////////////////////////////////////////
 
     Array(const value_type& value = value_type{0}) noexcept
-      : manip_type(_data)
     {
       operator=(value);
     }
@@ -114,7 +93,6 @@ namespace cs {
     // List Assignment ///////////////////////////////////////////////////////
 
     Array(const std::initializer_list<value_type>& list) noexcept
-      : manip_type(_data)
     {
       operator=(list);
     }
@@ -137,24 +115,35 @@ namespace cs {
 
     template<typename EXPR>
     Array(const ExprBase<traits_type,EXPR>& expr)
-      : manip_type(_data)
     {
-      operator=(expr);
+      assign(expr);
     }
 
+    /*
+     * NOTE:
+     * An expression reading its operands in non-elementwise order (cf.
+     * Transpose<>) would read this array after partially writing it; such
+     * an expression is evaluated into a temporary first. noalias() assigns
+     * it directly.
+     */
+
     template<typename EXPR>
     Array& operator=(const ExprBase<traits_type,EXPR>& expr) noexcept
     {
-      if constexpr( check_simd<EXPR,policy_type>() ) {
-        using ASSIGN = impl::BlockAssign<policy_type,EXPR>;
-        meta::for_each<DataBlocks,ASSIGN>(_data, expr.as_derived());
+      if constexpr( if_reordering_v<EXPR> ) {
+        const Array temp(expr);
+        operator=(temp);
       } else {
-        using ASSIGN = impl::ArrayAssign<policy_type,EXPR>;
-        meta::for_each<traits_type::Size,ASSIGN>(_data, expr.as_derived());
+        assign(expr);
       }
       return *this;
     }
 
+    inline impl::NoAlias<Array> noalias()
+    {
+      return impl::NoAlias<Array>(*this);
+    }
+
     // Assignment Operators //////////////////////////////////////////////////
 
     template<typename EXPR>
@@ -250,14 +239,40 @@ namespace cs {
 
     inline simd_type block(const std::size_t b) const
     {
-      return simd::load(&_data[b*simd::ElementCount]);
+      return storage::load(_data, b);
+    }
+
+  private:
+    friend class impl::NoAlias<Array>;
+
+    template<typename EXPR>
+    Array& assign(const ExprBase<traits_type,EXPR>& expr) noexcept
+    {
+      if constexpr( check_simd<EXPR,policy_type>() ) {
+        using ASSIGN = impl::BlockAssign<policy_type,EXPR>;
+        meta::for_each<DataBlocks,ASSIGN>(_data, expr.as_derived());
+      } else if constexpr( check_simd<EXPR,typename policy_type::transposed_type>() ) {
+        using ASSIGN = impl::BlockTransposeAssign<policy_type,EXPR>;
+        meta::for_each<DataBlocks,ASSIGN>(_data, expr.as_derived());
+      } else {
+        using ASSIGN = impl::ArrayAssign<policy_type,EXPR>;
+        meta::for_each<traits_type::Size,ASSIGN>(_data, expr.as_derived());
+      }
+      // NOTE: Blockwise consumers (e.g. Dot) rely on zero padding.
+      if constexpr( !check_simd<EXPR,policy_type>()  &&  DataSize - traits_type::Size > 0 ) {
+        using SET = impl::ArraySet<traits_type>;
+        meta::for_each<DataSize-traits_type::Size,SET>(_data + traits_type::Size, value_type{0});
+      }
+      return *this;
     }
 
   protected:
-    static constexpr std::size_t DataBlocks = simd::blocks(traits_type::Size);
-    static constexpr std::size_t   DataSize = simd::size(traits_type::Size);
+    using storage = impl::ArrayStorage<traits_type>;
+
+    static constexpr std::size_t DataBlocks = storage::DataBlocks;
+    static constexpr std::size_t   DataSize = storage::DataSize;
 
-    alignas(simd::Alignment) value_type _data[DataSize];
+    using manip_type::_data;
   };
 
 } // namespace cs
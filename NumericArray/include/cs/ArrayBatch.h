@@ -0,0 +1,388 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef ARRAYBATCH_H
+#define ARRAYBATCH_H
+
+#include <algorithm>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cs/impl/ArrayBatchImpl.h>
+#include <cs/Cholesky.h>
+#include <cs/EigenSymmetric.h>
+#include <cs/Functions.h>
+#include <cs/Manipulator.h>
+#include <cs/Meta.h>
+#include <cs/NumericArray.h>
+
+namespace cs {
+
+  /*
+   * NOTE:
+   * ArrayBatch<> stores N arrays in Structure-of-Arrays layout, i.e. each
+   * component (i,j) of all N arrays is stored contiguously. Expressions are
+   * evaluated for ElementCount arrays at once, by substituting each operand
+   * with a Packet<> valued leaf; cf. evaluate(). As batches are meant to be
+   * large and are returned by value, their storage is heap allocated like
+   * DynamicArray<>'s.
+   */
+
+  template<typename traits_T, std::size_t N>
+  class ArrayBatch {
+  public:
+    using   traits_type = traits_T;
+    using   policy_type = RowMajorPolicy<traits_type>;
+    using    value_type = typename traits_type::value_type;
+    using          simd = SIMD<value_type>;
+    using     simd_type = typename simd::simd_type;
+    using   packet_type = impl::Packet<value_type>;
+    using packet_traits = ArrayTraits<packet_type,traits_type::Rows,traits_type::Columns>;
+    using    array_type = Array<NoManipulator<policy_type>>;
+
+    static_assert(if_traits_v<traits_type>  &&  !if_dynamic_v<traits_type>);
+    static_assert(N > 0);
+
+    static constexpr std::size_t   Packets = simd::blocks(N);
+    static constexpr std::size_t    Stride = Packets*simd::ElementCount;
+    static constexpr std::size_t Alignment = sizeof(simd_type);
+
+    static constexpr std::size_t  DataSize = traits_type::Size*Stride;
+
+    ArrayBatch(const value_type& value = value_type{0})
+    {
+      allocate();
+      std::fill(_data, _data + DataSize, value);
+    }
+
+    ~ArrayBatch() noexcept
+    {
+      release();
+    }
+
+    // Copy Assignment ///////////////////////////////////////////////////////
+
+    ArrayBatch(const ArrayBatch& other)
+    {
+      operator=(other);
+    }
+
+    /*
+     * NOTE:
+     * A moved-from batch holds no storage until it is assigned to again.
+     */
+    ArrayBatch& operator=(const ArrayBatch& other)
+    {
+      if( this == &other ) {
+        return *this;
+      }
+      if( other._data == nullptr ) {
+        release();
+      } else {
+        if( _data == nullptr ) {
+          allocate();
+        }
+        std::copy(other._data, other._data + DataSize, _data);
+      }
+      return *this;
+    }
+
+    // Move Assignment ///////////////////////////////////////////////////////
+
+    ArrayBatch(ArrayBatch&& other) noexcept
+    {
+      std::swap(_data, other._data);
+    }
+
+    ArrayBatch& operator=(ArrayBatch&& other) noexcept
+    {
+      std::swap(_data, other._data);
+      return *this;
+    }
+
+    // Element Access ////////////////////////////////////////////////////////
+
+    constexpr std::size_t size() const
+    {
+      return N;
+    }
+
+    inline array_type get(const std::size_t n) const
+    {
+      array_type a;
+      for(std::size_t l = 0; l < traits_type::Size; l++) {
+        a(policy_type::row(l), policy_type::column(l)) = _data[l*Stride + n];
+      }
+      return a;
+    }
+
+    template<typename EXPR>
+    inline void set(const std::size_t n, const ExprBase<traits_type,EXPR>& expr)
+    {
+      const array_type a = expr;
+      for(std::size_t l = 0; l < traits_type::Size; l++) {
+        _data[l*Stride + n] = a(policy_type::row(l), policy_type::column(l));
+      }
+    }
+
+    // Packet Access /////////////////////////////////////////////////////////
+
+    inline packet_type packet(const std::size_t l, const std::size_t k) const
+    {
+      return packet_type{simd::load(_data + l*Stride + k*simd::ElementCount)};
+    }
+
+    inline void setPacket(const std::size_t l, const std::size_t k, const packet_type& x)
+    {
+      simd::store(_data + l*Stride + k*simd::ElementCount, x.data());
+    }
+
+    // Batch Evaluation //////////////////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * func() is called with one packet valued leaf per batch in args and
+     * returns either an expression with this batch's dimensions or, for
+     * 1x1 batches, a packet; e.g. cs::dot().
+     */
+    template<typename FUNC, typename... ARGS>
+    ArrayBatch& evaluate(FUNC func, const ARGS&... args)
+    {
+      for(std::size_t k = 0; k < Packets; k++) {
+        const std::tuple<impl::BatchPacket<ARGS>...> leaves{impl::BatchPacket<ARGS>(args, k)...};
+        const auto result = std::apply(func, leaves);
+
+        using result_type = std::decay_t<decltype(result)>;
+        if constexpr( std::is_same_v<result_type,packet_type> ) {
+          static_assert(if_dimensions_v<traits_type,1,1>);
+          setPacket(0, k, result);
+        } else {
+          using STORE = impl::BatchStore<ArrayBatch,result_type>;
+          meta::for_each<traits_type::Size,STORE>(*this, k, result);
+        }
+      }
+      return *this;
+    }
+
+  private:
+    void allocate()
+    {
+      _data = static_cast<value_type*>(::operator new(DataSize*sizeof(value_type),
+                                                      std::align_val_t{Alignment}));
+    }
+
+    void release()
+    {
+      if( _data != nullptr ) {
+        ::operator delete(_data, std::align_val_t{Alignment});
+      }
+      _data = nullptr;
+    }
+
+    value_type *_data{nullptr};
+  };
+
+  // Batch Functions /////////////////////////////////////////////////////////
+
+  template<typename traits_T, std::size_t N>
+  using ScalarBatch = ArrayBatch<ArrayTraits<typename traits_T::value_type,1,1>,N>;
+
+  /*
+   * NOTE:
+   * cholesky() factors ElementCount matrices at once, by evaluating the
+   * factorization's kernels with packets. The strictly upper triangle of
+   * each factor is zero.
+   */
+
+  template<typename traits_T, std::size_t N>
+  inline ArrayBatch<traits_T,N> cholesky(const ArrayBatch<traits_T,N>& A)
+  {
+    using  batch_type = ArrayBatch<traits_T,N>;
+    using packet_type = typename batch_type::packet_type;
+    using policy_type = typename batch_type::policy_type;
+    using      COLUMN = impl::CholeskyColumn<packet_type,traits_T::Rows>;
+
+    static_assert(if_quadratic_v<traits_T>);
+
+    batch_type result;
+    for(std::size_t k = 0; k < batch_type::Packets; k++) {
+      packet_type L[traits_T::Size];
+      for(std::size_t l = 0; l < traits_T::Size; l++) {
+        if( policy_type::column(l) <= policy_type::row(l) ) {
+          L[l] = A.packet(l, k);
+        }
+      }
+
+      meta::for_each<traits_T::Rows,COLUMN>(L);
+
+      for(std::size_t l = 0; l < traits_T::Size; l++) {
+        result.setPacket(l, k, L[l]);
+      }
+    }
+    return result;
+  }
+
+  /*
+   * NOTE:
+   * Solves A*x = b for each matrix of the batch, given the factors L of A
+   * computed by cholesky().
+   */
+
+  template<typename traits_T, typename rhs_T, std::size_t N>
+  inline ArrayBatch<rhs_T,N> choleskySolve(const ArrayBatch<traits_T,N>& L,
+                                           const ArrayBatch<rhs_T,N>& b)
+  {
+    using  batch_type = ArrayBatch<rhs_T,N>;
+    using packet_type = typename batch_type::packet_type;
+    using policy_type = typename batch_type::policy_type;
+    using     FORWARD = impl::LowerForward<packet_type,traits_T::Rows,false>;
+    using    BACKWARD = impl::LowerBackward<packet_type,traits_T::Rows,false>;
+
+    static_assert(if_quadratic_v<traits_T>  &&  rhs_T::Rows == traits_T::Rows);
+
+    batch_type result;
+    for(std::size_t k = 0; k < batch_type::Packets; k++) {
+      packet_type Lk[traits_T::Size];
+      for(std::size_t l = 0; l < traits_T::Size; l++) {
+        Lk[l] = L.packet(l, k);
+      }
+
+      for(std::size_t j = 0; j < rhs_T::Columns; j++) {
+        packet_type x[rhs_T::Rows];
+        for(std::size_t i = 0; i < rhs_T::Rows; i++) {
+          x[i] = b.packet(policy_type::index(i, j), k);
+        }
+
+        meta::for_each<traits_T::Rows,FORWARD>(Lk, x);
+        meta::for_each<traits_T::Rows,BACKWARD>(Lk, x);
+
+        for(std::size_t i = 0; i < rhs_T::Rows; i++) {
+          result.setPacket(policy_type::index(i, j), k, x[i]);
+        }
+      }
+    }
+    return result;
+  }
+
+  template<typename traits_T, std::size_t N>
+  inline ArrayBatch<traits_T,N> cross(const ArrayBatch<traits_T,N>& a,
+                                      const ArrayBatch<traits_T,N>& b)
+  {
+    ArrayBatch<traits_T,N> result;
+    result.evaluate([](const auto& x, const auto& y) {
+      return cross(x, y);
+    }, a, b);
+    return result;
+  }
+
+  template<typename traits_T, std::size_t N>
+  inline ScalarBatch<traits_T,N> dot(const ArrayBatch<traits_T,N>& a,
+                                     const ArrayBatch<traits_T,N>& b)
+  {
+    ScalarBatch<traits_T,N> result;
+    result.evaluate([](const auto& x, const auto& y) {
+      return dot(x, y);
+    }, a, b);
+    return result;
+  }
+
+  /*
+   * NOTE:
+   * eigenSymmetric3x3() decomposes ElementCount symmetric matrices at once
+   * using a fixed number of branch-free Jacobi sweeps. The first batch
+   * holds the eigenvalues sorted ascending, the second batch holds the
+   * corresponding eigenvectors as columns.
+   */
+
+  template<typename traits_T, std::size_t N>
+  inline auto eigenSymmetric3x3(const ArrayBatch<traits_T,N>& A)
+  {
+    using  value_type = typename traits_T::value_type;
+    using  batch_type = ArrayBatch<traits_T,N>;
+    using values_type = ArrayBatch<ArrayTraits<value_type,3,1>,N>;
+    using packet_type = typename batch_type::packet_type;
+    using      JACOBI = impl::EigenJacobi3x3<packet_type,value_type>;
+
+    static_assert(if_dimensions_v<traits_T,3,3>);
+
+    constexpr std::size_t Sweeps = 6;
+
+    std::pair<values_type,batch_type> result;
+    for(std::size_t k = 0; k < batch_type::Packets; k++) {
+      packet_type a[9];
+      for(std::size_t i = 0; i < 3; i++) {
+        for(std::size_t j = 0; j <= i; j++) {
+          a[i*3 + j] = a[j*3 + i] = A.packet(i*3 + j, k);
+        }
+      }
+
+      packet_type w[3], v[9];
+      JACOBI::identity(v);
+      for(std::size_t sweep = 0; sweep < Sweeps; sweep++) {
+        JACOBI::sweep(a, v);
+      }
+      JACOBI::finish(a, w, v);
+
+      for(std::size_t l = 0; l < 3; l++) {
+        result.first.setPacket(l, k, w[l]);
+      }
+      for(std::size_t l = 0; l < 9; l++) {
+        result.second.setPacket(l, k, v[l]);
+      }
+    }
+    return result;
+  }
+
+  template<typename traits_T, std::size_t N>
+  inline ScalarBatch<traits_T,N> length(const ArrayBatch<traits_T,N>& a)
+  {
+    ScalarBatch<traits_T,N> result;
+    result.evaluate([](const auto& x) {
+      return length(x);
+    }, a);
+    return result;
+  }
+
+  template<typename traits_T, std::size_t N>
+  inline ArrayBatch<traits_T,N> normalize(const ArrayBatch<traits_T,N>& a)
+  {
+    ArrayBatch<traits_T,N> result;
+    result.evaluate([](const auto& x) {
+      return normalize(x);
+    }, a);
+    return result;
+  }
+
+} // namespace cs
+
+#endif // ARRAYBATCH_H
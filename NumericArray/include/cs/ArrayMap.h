@@ -0,0 +1,286 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef ARRAYMAP_H
+#define ARRAYMAP_H
+
+#include <cs/impl/ArrayImpl.h>
+#include <cs/impl/BinaryOperatorsImpl.h>
+#include <cs/Array.h>
+#include <cs/ArrayPolicy.h>
+#include <cs/ListAssign.h>
+#include <cs/Manipulator.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  /*
+   * NOTE:
+   * ArrayView<> and ArrayMap<> do NOT own their data; they access Size
+   * elements of caller-provided memory, which is neither required to be
+   * aligned nor padded.
+   */
+
+  ////// Read-Only View //////////////////////////////////////////////////////
+
+  template<typename policy_T>
+  class ArrayView
+      : public ExprBase<typename policy_T::traits_type,ArrayView<policy_T>> {
+  public:
+    using policy_type = policy_T;
+    using traits_type = typename policy_type::traits_type;
+    using   list_type = ListAssign<traits_type>;
+    using  value_type = typename traits_type::value_type;
+    using        simd = SIMD<value_type>;
+    using   simd_type = typename simd::simd_type;
+
+    static constexpr bool is_leaf = true;
+
+    static_assert(if_traits_v<traits_type>  &&  !if_dynamic_v<traits_type>);
+
+    ArrayView(const value_type *data) noexcept
+      : _data{const_cast<value_type*>(data)}
+    {
+    }
+
+    ArrayView(const ArrayView&) noexcept = default;
+
+    ~ArrayView() noexcept = default;
+
+    // Element Access ////////////////////////////////////////////////////////
+
+    constexpr value_type operator()(const std::size_t i, const std::size_t j) const
+    {
+      return _data[policy_type::index(i, j)];
+    }
+
+    constexpr value_type operator[](const std::size_t l) const
+    {
+      return _data[l];
+    }
+
+    inline const value_type *data() const
+    {
+      return _data;
+    }
+
+    // Query Size ////////////////////////////////////////////////////////////
+
+    constexpr std::size_t rows() const
+    {
+      return traits_type::Rows;
+    }
+
+    constexpr std::size_t columns() const
+    {
+      return traits_type::Columns;
+    }
+
+    constexpr std::size_t size() const
+    {
+      return traits_type::Size;
+    }
+
+    // Compile-Time Element Access ///////////////////////////////////////////
+
+    template<std::size_t i, std::size_t j>
+    inline value_type eval() const
+    {
+      return _data[policy_type::index(i, j)];
+    }
+
+    // SIMD Interface ////////////////////////////////////////////////////////
+
+    template<typename simd_policy_T, bool check_policy>
+    static constexpr bool is_simd()
+    {
+      if constexpr( check_policy ) {
+        return policy_type::template is_same_v<simd_policy_T>;
+      }
+      return true;
+    }
+
+    inline simd_type block(const std::size_t b) const
+    {
+      return storage::load(_data, b);
+    }
+
+  protected:
+    using storage = impl::MapStorage<traits_type>;
+
+    static constexpr std::size_t DataBlocks = storage::DataBlocks;
+
+    ArrayView& operator=(const ArrayView&) noexcept = default;
+
+    value_type *_data{nullptr};
+  };
+
+  ////// Read-Write Map //////////////////////////////////////////////////////
+
+  template<typename policy_T>
+  class ArrayMap : public ArrayView<policy_T> {
+  public:
+    using view_type = ArrayView<policy_T>;
+    using typename view_type::policy_type;
+    using typename view_type::traits_type;
+    using typename view_type::list_type;
+    using typename view_type::value_type;
+
+    ArrayMap(value_type *data) noexcept
+      : view_type(data)
+    {
+    }
+
+    ArrayMap(const ArrayMap&) noexcept = default;
+
+    ~ArrayMap() noexcept = default;
+
+    // Copy Assignment ///////////////////////////////////////////////////////
+
+    ArrayMap& operator=(const ArrayMap& other) noexcept
+    {
+      if( _data != other._data ) {
+        operator=(static_cast<const view_type&>(other));
+      }
+      return *this;
+    }
+
+    // Scalar Assignment /////////////////////////////////////////////////////
+
+    ArrayMap& operator=(const value_type& value) noexcept
+    {
+      using SET = impl::BlockSet<traits_type,storage>;
+      meta::for_each<DataBlocks,SET>(_data, value);
+      return *this;
+    }
+
+    // Expression Assignment /////////////////////////////////////////////////
+
+    template<typename EXPR>
+    ArrayMap& operator=(const ExprBase<traits_type,EXPR>& expr) noexcept
+    {
+      if constexpr( if_reordering_v<EXPR> ) {
+        const Array<NoManipulator<policy_type>> temp(expr);
+        assign(temp);
+      } else {
+        assign(expr);
+      }
+      return *this;
+    }
+
+    inline impl::NoAlias<ArrayMap> noalias()
+    {
+      return impl::NoAlias<ArrayMap>(*this);
+    }
+
+    // Assignment Operators //////////////////////////////////////////////////
+
+    template<typename EXPR>
+    ArrayMap& operator+=(const ExprBase<traits_type,EXPR>& expr)
+    {
+      operator=(impl::BinAdd<traits_type,view_type,EXPR>(*this, expr.as_derived()));
+      return *this;
+    }
+
+    template<typename EXPR>
+    ArrayMap& operator-=(const ExprBase<traits_type,EXPR>& expr)
+    {
+      operator=(impl::BinSub<traits_type,view_type,EXPR>(*this, expr.as_derived()));
+      return *this;
+    }
+
+    ArrayMap& operator*=(const value_type s)
+    {
+      operator=(impl::BinSMul<traits_type,view_type>(*this, s));
+      return *this;
+    }
+
+    ArrayMap& operator/=(const value_type s)
+    {
+      operator=(impl::BinSDiv<traits_type,view_type>(*this, s));
+      return *this;
+    }
+
+    template<typename EXPR>
+    ArrayMap& operator%=(const ExprBase<traits_type,EXPR>& expr)
+    {
+      operator=(impl::BinProduct<traits_type,view_type,EXPR>(*this, expr.as_derived()));
+      return *this;
+    }
+
+    // Element Access ////////////////////////////////////////////////////////
+
+    using view_type::operator();
+    using view_type::operator[];
+    using view_type::data;
+
+    inline value_type& operator()(const std::size_t i, const std::size_t j)
+    {
+      return _data[policy_type::index(i, j)];
+    }
+
+    inline value_type& operator[](const std::size_t l)
+    {
+      return _data[l];
+    }
+
+    inline value_type *data()
+    {
+      return _data;
+    }
+
+  private:
+    friend class impl::NoAlias<ArrayMap>;
+
+    template<typename EXPR>
+    ArrayMap& assign(const ExprBase<traits_type,EXPR>& expr) noexcept
+    {
+      if constexpr( check_simd<EXPR,policy_type>() ) {
+        using ASSIGN = impl::BlockAssign<policy_type,EXPR,storage>;
+        meta::for_each<DataBlocks,ASSIGN>(_data, expr.as_derived());
+      } else if constexpr( check_simd<EXPR,typename policy_type::transposed_type>() ) {
+        using ASSIGN = impl::BlockTransposeAssign<policy_type,EXPR>;
+        meta::for_each<DataBlocks,ASSIGN>(_data, expr.as_derived());
+      } else {
+        using ASSIGN = impl::ArrayAssign<policy_type,EXPR>;
+        meta::for_each<traits_type::Size,ASSIGN>(_data, expr.as_derived());
+      }
+      return *this;
+    }
+
+    using typename view_type::storage;
+    using view_type::DataBlocks;
+    using view_type::_data;
+  };
+
+} // namespace cs
+
+#endif // ARRAYMAP_H
@@ -56,9 +56,13 @@ namespace cs {
     std::is_same_v<typename policy_type::template make_policy<typename other_T::traits_type>,other_T>;
   };
 
+  template<typename traits_T>
+  struct ColumnMajorPolicy;
+
   template<typename traits_T>
   struct RowMajorPolicy : public ArrayPolicyBase<traits_T,RowMajorPolicy> {
-    using traits_type = traits_T;
+    using     traits_type = traits_T;
+    using transposed_type = ColumnMajorPolicy<traits_type>;
 
     static constexpr std::size_t column(const std::size_t l)
     {
@@ -76,6 +80,32 @@ namespace cs {
     }
   };
 
+  /*
+   * NOTE:
+   * The storage of a column-major matrix equals the storage of its transpose
+   * in row-major order and vice versa; cf. transposed_type.
+   */
+  template<typename traits_T>
+  struct ColumnMajorPolicy : public ArrayPolicyBase<traits_T,ColumnMajorPolicy> {
+    using     traits_type = traits_T;
+    using transposed_type = RowMajorPolicy<traits_type>;
+
+    static constexpr std::size_t column(const std::size_t l)
+    {
+      return l/traits_type::Rows;
+    }
+
+    static constexpr std::size_t index(const std::size_t i, const std::size_t j)
+    {
+      return j*traits_type::Rows + i;
+    }
+
+    static constexpr std::size_t row(const std::size_t l)
+    {
+      return l%traits_type::Rows;
+    }
+  };
+
 } // namespace cs
 
 #endif // ARRAYPOLICY_H
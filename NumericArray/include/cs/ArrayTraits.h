@@ -45,6 +45,21 @@ namespace cs {
     static constexpr std::size_t    Size = COLS*ROWS;
   };
 
+  /*
+   * NOTE:
+   * The size of a dynamic array is only known at runtime; hence all of its
+   * dimensions are reported as zero.
+   */
+  template<typename value_T>
+  struct DynamicTraits {
+    using value_type = value_T;
+
+    static constexpr bool        Dynamic = true;
+    static constexpr std::size_t Columns = 0;
+    static constexpr std::size_t    Rows = 0;
+    static constexpr std::size_t    Size = 0;
+  };
+
 } // namespace cs
 
 #endif // ARRAYTRAITS_H
@@ -0,0 +1,120 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef CPU_H
+#define CPU_H
+
+#include <cstdlib>
+#include <cstring>
+
+namespace cs {
+
+  ////// Instruction Set Architecture ////////////////////////////////////////
+
+  enum class ISA : int {
+    SSE2 = 0,
+    AVX2,
+    AVX512
+  };
+
+  inline const char *isaName(const ISA isa)
+  {
+    if(        isa == ISA::AVX512 ) {
+      return "avx512";
+    } else if( isa == ISA::AVX2 ) {
+      return "avx2";
+    }
+    return "sse2";
+  }
+
+  ////// Runtime Detection ///////////////////////////////////////////////////
+
+  /*
+   * NOTE:
+   * AVX2 requires FMA and AVX-512 requires AVX-512F; the compiler's runtime
+   * also verifies the OS saves the corresponding register state.
+   */
+
+  inline ISA cpuISA()
+  {
+#if defined(__GNUC__)
+    __builtin_cpu_init();
+    const bool have_avx2   = __builtin_cpu_supports("avx2")  &&  __builtin_cpu_supports("fma");
+    const bool have_avx512 = have_avx2  &&  __builtin_cpu_supports("avx512f");
+#else
+# if defined(__AVX2__)
+    const bool have_avx2   = true;
+# else
+    const bool have_avx2   = false;
+# endif
+# if defined(__AVX512F__)
+    const bool have_avx512 = true;
+# else
+    const bool have_avx512 = false;
+# endif
+#endif
+    if(        have_avx512 ) {
+      return ISA::AVX512;
+    } else if( have_avx2 ) {
+      return ISA::AVX2;
+    }
+    return ISA::SSE2;
+  }
+
+  /*
+   * NOTE:
+   * The environment variable CS_SIMD_DISPATCH (one of "sse2", "avx2" or
+   * "avx512") limits the dispatched ISA; it never exceeds cpuISA().
+   */
+
+  inline ISA dispatchISA()
+  {
+    static const ISA isa = [] {
+      const ISA cpu = cpuISA();
+      const char *env = std::getenv("CS_SIMD_DISPATCH");
+      if( env == nullptr ) {
+        return cpu;
+      }
+      for(const ISA request : {ISA::SSE2, ISA::AVX2, ISA::AVX512}) {
+        if( std::strcmp(env, isaName(request)) == 0 ) {
+          return request < cpu
+              ? request
+              : cpu;
+        }
+      }
+      return cpu;
+    }();
+    return isa;
+  }
+
+} // namespace cs
+
+#endif // CPU_H
@@ -0,0 +1,335 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef CHOLESKY_H
+#define CHOLESKY_H
+
+#include <type_traits>
+
+#include <cs/impl/CholeskyImpl.h>
+#include <cs/Array.h>
+#include <cs/ArrayPolicy.h>
+#include <cs/ArrayTraits.h>
+#include <cs/ExprBase.h>
+#include <cs/Manipulator.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  /*
+   * NOTE:
+   * Cholesky<> factors a symmetric, positive definite matrix A into
+   * L*transpose(L), where L is lower triangular. Only the lower triangle of
+   * A is read; hence the factorization requires about half the work of LU<>.
+   */
+
+  template<typename traits_T>
+  class Cholesky {
+  public:
+    using traits_type = traits_T;
+    using  value_type = typename traits_type::value_type;
+    using  array_type = Array<NoManipulator<RowMajorPolicy<traits_type>>>;
+
+    static_assert(if_quadratic_v<traits_type>);
+
+    template<typename ARG>
+    Cholesky(const ExprBase<traits_type,ARG>& arg) noexcept
+    {
+      using LOAD = impl::LowerLoad<N,ARG>;
+      meta::for_each<traits_type::Size,LOAD>(_l, arg.as_derived());
+
+      using COLUMN = impl::CholeskyColumn<value_type,N>;
+      meta::for_each<N,COLUMN>(_l);
+    }
+
+    ~Cholesky() noexcept = default;
+
+    // Results ///////////////////////////////////////////////////////////////
+
+    value_type determinant() const
+    {
+      using PRODUCT = impl::DiagonalProduct<value_type,N>;
+      const value_type d = meta::accumulate<value_type,N,PRODUCT>(_l);
+      return d*d;
+    }
+
+    /*
+     * NOTE:
+     * A matrix which is not positive definite results in a non-positive or
+     * NaN diagonal element of L.
+     */
+    bool isPositiveDefinite() const
+    {
+      for(std::size_t i = 0; i < N; i++) {
+        if( !(_l[i*N + i] > value_type{0}) ) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    template<typename rhs_T, typename ARG>
+    Array<NoManipulator<RowMajorPolicy<rhs_T>>> solve(const ExprBase<rhs_T,ARG>& rhs) const
+    {
+      static_assert(std::is_same_v<typename rhs_T::value_type,value_type>  &&
+                    rhs_T::Rows == N);
+      using rhs_type = Array<NoManipulator<RowMajorPolicy<rhs_T>>>;
+      using  FORWARD = impl::LowerForward<value_type,N,false>;
+      using BACKWARD = impl::LowerBackward<value_type,N,false>;
+
+      rhs_type result(rhs);
+      for(std::size_t j = 0; j < rhs_T::Columns; j++) {
+        value_type x[N];
+        for(std::size_t i = 0; i < N; i++) {
+          x[i] = result(i, j);
+        }
+
+        meta::for_each<N,FORWARD>(_l, x);
+        meta::for_each<N,BACKWARD>(_l, x);
+
+        for(std::size_t i = 0; i < N; i++) {
+          result(i, j) = x[i];
+        }
+      }
+      return result;
+    }
+
+    // Factors ///////////////////////////////////////////////////////////////
+
+    array_type matrixL() const
+    {
+      array_type L;
+      for(std::size_t i = 0; i < N; i++) {
+        for(std::size_t j = 0; j <= i; j++) {
+          L(i, j) = _l[i*N + j];
+        }
+      }
+      return L;
+    }
+
+    // Rank-1 Modification ///////////////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * update()/downdate() modify the factors in place to those of
+     * A + x*transpose(x) and A - x*transpose(x), respectively. A downdate
+     * yielding a matrix which is not positive definite is detected by
+     * isPositiveDefinite().
+     */
+
+    template<typename vec_T, typename ARG>
+    Cholesky& update(const ExprBase<vec_T,ARG>& x)
+    {
+      return modify(x, value_type{1});
+    }
+
+    template<typename vec_T, typename ARG>
+    Cholesky& downdate(const ExprBase<vec_T,ARG>& x)
+    {
+      return modify(x, value_type{-1});
+    }
+
+  private:
+    static constexpr std::size_t N = traits_type::Rows;
+
+    template<typename vec_T, typename ARG>
+    Cholesky& modify(const ExprBase<vec_T,ARG>& x, const value_type sigma)
+    {
+      static_assert(std::is_same_v<typename vec_T::value_type,value_type>  &&
+                    if_dimensions_v<vec_T,N,1>);
+      using UPDATE = impl::CholeskyUpdate<value_type,N>;
+
+      const Array<NoManipulator<RowMajorPolicy<vec_T>>> v(x);
+
+      value_type w[N];
+      for(std::size_t i = 0; i < N; i++) {
+        w[i] = v(i, 0);
+      }
+
+      meta::for_each<N,UPDATE>(_l, w, sigma);
+
+      return *this;
+    }
+
+    value_type _l[N*N]{};
+  };
+
+  /*
+   * NOTE:
+   * LDLT<> factors a symmetric matrix A into L*D*transpose(L), where L is
+   * lower triangular with a unit diagonal and D is diagonal. Unlike
+   * Cholesky<>, no square roots are computed. No pivoting is performed;
+   * hence A is required to be positive or negative definite.
+   */
+
+  template<typename traits_T>
+  class LDLT {
+  public:
+    using traits_type = traits_T;
+    using  value_type = typename traits_type::value_type;
+    using  array_type = Array<NoManipulator<RowMajorPolicy<traits_type>>>;
+    using vector_type = Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_type,traits_type::Rows,1>>>>;
+
+    static_assert(if_quadratic_v<traits_type>);
+
+    template<typename ARG>
+    LDLT(const ExprBase<traits_type,ARG>& arg) noexcept
+    {
+      using LOAD = impl::LowerLoad<N,ARG>;
+      meta::for_each<traits_type::Size,LOAD>(_l, arg.as_derived());
+
+      using COLUMN = impl::LDLTColumn<value_type,N>;
+      meta::for_each<N,COLUMN>(_l);
+    }
+
+    ~LDLT() noexcept = default;
+
+    // Results ///////////////////////////////////////////////////////////////
+
+    value_type determinant() const
+    {
+      using PRODUCT = impl::DiagonalProduct<value_type,N>;
+      return meta::accumulate<value_type,N,PRODUCT>(_l);
+    }
+
+    template<typename rhs_T, typename ARG>
+    Array<NoManipulator<RowMajorPolicy<rhs_T>>> solve(const ExprBase<rhs_T,ARG>& rhs) const
+    {
+      static_assert(std::is_same_v<typename rhs_T::value_type,value_type>  &&
+                    rhs_T::Rows == N);
+      using rhs_type = Array<NoManipulator<RowMajorPolicy<rhs_T>>>;
+      using  FORWARD = impl::LowerForward<value_type,N,true>;
+      using DIAGONAL = impl::DiagonalDivide<value_type,N>;
+      using BACKWARD = impl::LowerBackward<value_type,N,true>;
+
+      rhs_type result(rhs);
+      for(std::size_t j = 0; j < rhs_T::Columns; j++) {
+        value_type x[N];
+        for(std::size_t i = 0; i < N; i++) {
+          x[i] = result(i, j);
+        }
+
+        meta::for_each<N,FORWARD>(_l, x);
+        meta::for_each<N,DIAGONAL>(_l, x);
+        meta::for_each<N,BACKWARD>(_l, x);
+
+        for(std::size_t i = 0; i < N; i++) {
+          result(i, j) = x[i];
+        }
+      }
+      return result;
+    }
+
+    // Factors ///////////////////////////////////////////////////////////////
+
+    array_type matrixL() const
+    {
+      array_type L;
+      for(std::size_t i = 0; i < N; i++) {
+        for(std::size_t j = 0; j < i; j++) {
+          L(i, j) = _l[i*N + j];
+        }
+        L(i, i) = value_type{1};
+      }
+      return L;
+    }
+
+    vector_type vectorD() const
+    {
+      vector_type D;
+      for(std::size_t i = 0; i < N; i++) {
+        D(i, 0) = _l[i*N + i];
+      }
+      return D;
+    }
+
+    // Rank-1 Modification ///////////////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * update()/downdate() modify the factors in place to those of
+     * A + x*transpose(x) and A - x*transpose(x), respectively.
+     */
+
+    template<typename vec_T, typename ARG>
+    LDLT& update(const ExprBase<vec_T,ARG>& x)
+    {
+      return modify(x, value_type{1});
+    }
+
+    template<typename vec_T, typename ARG>
+    LDLT& downdate(const ExprBase<vec_T,ARG>& x)
+    {
+      return modify(x, value_type{-1});
+    }
+
+  private:
+    static constexpr std::size_t N = traits_type::Rows;
+
+    template<typename vec_T, typename ARG>
+    LDLT& modify(const ExprBase<vec_T,ARG>& x, value_type alpha)
+    {
+      static_assert(std::is_same_v<typename vec_T::value_type,value_type>  &&
+                    if_dimensions_v<vec_T,N,1>);
+      using UPDATE = impl::LDLTUpdate<value_type,N>;
+
+      const Array<NoManipulator<RowMajorPolicy<vec_T>>> v(x);
+
+      value_type w[N];
+      for(std::size_t i = 0; i < N; i++) {
+        w[i] = v(i, 0);
+      }
+
+      meta::for_each<N,UPDATE>(_l, w, alpha);
+
+      return *this;
+    }
+
+    value_type _l[N*N]{};
+  };
+
+  // Decomposition ///////////////////////////////////////////////////////////
+
+  template<typename traits_T, typename ARG>
+  inline Cholesky<traits_T> cholesky(const ExprBase<traits_T,ARG>& arg)
+  {
+    return Cholesky<traits_T>(arg);
+  }
+
+  template<typename traits_T, typename ARG>
+  inline LDLT<traits_T> ldlt(const ExprBase<traits_T,ARG>& arg)
+  {
+    return LDLT<traits_T>(arg);
+  }
+
+} // namespace cs
+
+#endif // CHOLESKY_H
@@ -0,0 +1,321 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef DYNAMICARRAY_H
+#define DYNAMICARRAY_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+#include <cs/ArrayTraits.h>
+#include <cs/BinaryOperators.h>
+#include <cs/Functions.h>
+#include <cs/Kernels.h>
+#include <cs/SIMD.h>
+#include <cs/UnaryOperators.h>
+
+namespace cs {
+
+  /*
+   * NOTE:
+   * DynamicArray<> is a heap allocated column vector, whose size is set at
+   * runtime. Its storage is aligned to and padded to a multiple of the SIMD
+   * register's size; expressions are evaluated using a runtime loop over all
+   * blocks. Hence all operands of an expression are required to be of
+   * identical size and to be SIMD-capable; the result of an expression
+   * assignment has the size of its operands.
+   */
+
+  template<typename value_T>
+  class DynamicArray
+      : public ExprBase<DynamicTraits<value_T>,DynamicArray<value_T>> {
+  public:
+    using traits_type = DynamicTraits<value_T>;
+    using  value_type = typename traits_type::value_type;
+    using        simd = SIMD<value_type>;
+    using   simd_type = typename simd::simd_type;
+
+    static constexpr std::size_t Alignment = sizeof(simd_type);
+
+    static constexpr bool is_leaf = true;
+
+    static_assert(if_traits_v<traits_type>);
+
+    ~DynamicArray() noexcept
+    {
+      release();
+    }
+
+    // Copy Assignment ///////////////////////////////////////////////////////
+
+    DynamicArray(const DynamicArray& other)
+    {
+      operator=(other);
+    }
+
+    DynamicArray& operator=(const DynamicArray& other)
+    {
+      if( this != &other ) {
+        allocate(other._size);
+        kernels::copy(_data, other._data, capacity());
+      }
+      return *this;
+    }
+
+    // Move Assignment ///////////////////////////////////////////////////////
+
+    DynamicArray(DynamicArray&& other) noexcept
+    {
+      operator=(std::move(other));
+    }
+
+    DynamicArray& operator=(DynamicArray&& other) noexcept
+    {
+      if( this != &other ) {
+        std::swap(_data, other._data);
+        std::swap(_size, other._size);
+      }
+      return *this;
+    }
+
+    // Scalar Assignment /////////////////////////////////////////////////////
+
+    explicit DynamicArray(const std::size_t size = 0, const value_type& value = value_type{0})
+    {
+      allocate(size);
+      operator=(value);
+    }
+
+    DynamicArray& operator=(const value_type& value) noexcept
+    {
+      kernels::assign(_data, value, _size);
+      return *this;
+    }
+
+    // List Assignment ///////////////////////////////////////////////////////
+
+    DynamicArray(const std::initializer_list<value_type>& list)
+    {
+      operator=(list);
+    }
+
+    DynamicArray& operator=(const std::initializer_list<value_type>& list)
+    {
+      allocate(list.size());
+      std::copy(list.begin(), list.end(), _data);
+      return *this;
+    }
+
+    // Expression Assignment /////////////////////////////////////////////////
+
+    template<typename EXPR>
+    DynamicArray(const ExprBase<traits_type,EXPR>& expr)
+    {
+      operator=(expr);
+    }
+
+    /*
+     * NOTE:
+     * The array is resized to the expression's size. As the expression may
+     * reference this array (e.g. operator+=()), a differently sized result is
+     * evaluated into a new array first.
+     */
+
+    template<typename EXPR>
+    DynamicArray& operator=(const ExprBase<traits_type,EXPR>& expr)
+    {
+      static_assert(check_simd<EXPR,NoPolicy,false>(),
+                    "Expressions of DynamicArray<> require SIMD-capable operands!");
+      const EXPR& src = expr.as_derived();
+      const std::size_t size = src.size();
+      if( size != _size ) {
+        DynamicArray other(size);
+        other.assign(src);
+        operator=(std::move(other));
+      } else {
+        assign(src);
+      }
+      return *this;
+    }
+
+    // Assignment Operators //////////////////////////////////////////////////
+
+    template<typename EXPR>
+    DynamicArray& operator+=(const ExprBase<traits_type,EXPR>& expr)
+    {
+      operator=(impl::BinAdd<traits_type,DynamicArray,EXPR>(*this, expr.as_derived()));
+      return *this;
+    }
+
+    template<typename EXPR>
+    DynamicArray& operator-=(const ExprBase<traits_type,EXPR>& expr)
+    {
+      operator=(impl::BinSub<traits_type,DynamicArray,EXPR>(*this, expr.as_derived()));
+      return *this;
+    }
+
+    DynamicArray& operator*=(const value_type s)
+    {
+      operator=(impl::BinSMul<traits_type,DynamicArray>(*this, s));
+      return *this;
+    }
+
+    DynamicArray& operator/=(const value_type s)
+    {
+      operator=(impl::BinSDiv<traits_type,DynamicArray>(*this, s));
+      return *this;
+    }
+
+    template<typename EXPR>
+    DynamicArray& operator%=(const ExprBase<traits_type,EXPR>& expr)
+    {
+      operator=(impl::BinProduct<traits_type,DynamicArray,EXPR>(*this, expr.as_derived()));
+      return *this;
+    }
+
+    // Element Access ////////////////////////////////////////////////////////
+
+    inline value_type operator[](const std::size_t l) const
+    {
+      return _data[l];
+    }
+
+    inline value_type& operator[](const std::size_t l)
+    {
+      return _data[l];
+    }
+
+    inline const value_type *data() const
+    {
+      return _data;
+    }
+
+    inline value_type *data()
+    {
+      return _data;
+    }
+
+    // Size //////////////////////////////////////////////////////////////////
+
+    inline std::size_t size() const
+    {
+      return _size;
+    }
+
+    /*
+     * NOTE:
+     * The first min(size(), size) elements are preserved; new elements are
+     * set to zero.
+     */
+    void resize(const std::size_t size)
+    {
+      if( size == _size ) {
+        return;
+      }
+      DynamicArray other(size);
+      kernels::copy(other._data, _data, std::min(_size, size));
+      operator=(std::move(other));
+    }
+
+    // SIMD Interface ////////////////////////////////////////////////////////
+
+    template<typename simd_policy_T, bool check_policy>
+    static constexpr bool is_simd()
+    {
+      return true;
+    }
+
+    inline simd_type block(const std::size_t b) const
+    {
+      return simd::load(_data + b*simd::ElementCount);
+    }
+
+  private:
+    struct NoPolicy { };
+
+    template<typename EXPR>
+    void assign(const EXPR& src) noexcept
+    {
+      const std::size_t count = blocks();
+      for(std::size_t b = 0; b < count; b++) {
+        simd::store(_data + b*simd::ElementCount, src.block(b));
+      }
+    }
+
+    inline std::size_t blocks() const
+    {
+      return simd::blocks(_size);
+    }
+
+    inline std::size_t capacity() const
+    {
+      return blocks()*simd::ElementCount;
+    }
+
+    void allocate(const std::size_t size)
+    {
+      if( simd::blocks(size) != blocks() ) {
+        release();
+        if( size > 0 ) {
+          const std::size_t bytes = simd::blocks(size)*simd::ElementCount*sizeof(value_type);
+          _data = static_cast<value_type*>(::operator new(bytes, std::align_val_t{Alignment}));
+        }
+      }
+      _size = size;
+      kernels::assign(_data, value_type{0}, capacity());
+    }
+
+    void release()
+    {
+      if( _data != nullptr ) {
+        ::operator delete(_data, std::align_val_t{Alignment});
+      }
+      _data = nullptr;
+      _size = 0;
+    }
+
+    value_type *_data{nullptr};
+    std::size_t _size{0};
+  };
+
+  // Dot Product /////////////////////////////////////////////////////////////
+
+  template<typename value_T>
+  inline value_T dot(const DynamicArray<value_T>& a, const DynamicArray<value_T>& b)
+  {
+    return kernels::dot(a.data(), b.data(), std::min(a.size(), b.size()));
+  }
+
+} // namespace cs
+
+#endif // DYNAMICARRAY_H
@@ -0,0 +1,126 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef EIGENSYMMETRIC_H
+#define EIGENSYMMETRIC_H
+
+#include <limits>
+
+#include <cs/impl/EigenSymmetricImpl.h>
+#include <cs/Array.h>
+#include <cs/ArrayPolicy.h>
+#include <cs/ArrayTraits.h>
+#include <cs/ExprBase.h>
+#include <cs/Manipulator.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  /*
+   * NOTE:
+   * EigenSymmetric3x3<> computes the eigenvalues and eigenvectors of a
+   * symmetric 3x3 matrix, of which only the lower triangle is read. The
+   * closed-form solution is used unless it is inaccurate due to (nearly)
+   * degenerate eigenvalues, in which case cyclic Jacobi rotations are
+   * applied. Eigenvalues are sorted ascending; the eigenvectors are the
+   * columns of a rotation matrix.
+   */
+
+  template<typename traits_T>
+  class EigenSymmetric3x3 {
+  public:
+    using traits_type = traits_T;
+    using  value_type = typename traits_type::value_type;
+    using  array_type = Array<NoManipulator<RowMajorPolicy<traits_type>>>;
+    using vector_type = Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_type,3,1>>>>;
+
+    static_assert(if_dimensions_v<traits_type,3,3>);
+
+    template<typename ARG>
+    EigenSymmetric3x3(const ExprBase<traits_type,ARG>& arg) noexcept
+    {
+      value_type a[9];
+      using LOAD = impl::SymmetricLoad3x3<ARG>;
+      meta::for_each<9,LOAD>(a, arg.as_derived());
+
+      if( impl::EigenAnalytic3x3<value_type>::run(a, _w, _v) ) {
+        return;
+      }
+
+      using JACOBI = impl::EigenJacobi3x3<value_type,value_type>;
+      constexpr value_type eps = std::numeric_limits<value_type>::epsilon();
+
+      JACOBI::identity(_v);
+      for(std::size_t sweep = 0; sweep < MaxSweeps; sweep++) {
+        const value_type off  = a[1]*a[1] + a[2]*a[2] + a[5]*a[5];
+        const value_type diag = a[0]*a[0] + a[4]*a[4] + a[8]*a[8];
+        if( off <= eps*eps*diag ) {
+          break;
+        }
+        JACOBI::sweep(a, _v);
+      }
+      JACOBI::finish(a, _w, _v);
+    }
+
+    ~EigenSymmetric3x3() noexcept = default;
+
+    vector_type eigenvalues() const
+    {
+      return vector_type{_w[0], _w[1], _w[2]};
+    }
+
+    array_type eigenvectors() const
+    {
+      array_type V;
+      for(std::size_t i = 0; i < 3; i++) {
+        for(std::size_t j = 0; j < 3; j++) {
+          V(i, j) = _v[i*3 + j];
+        }
+      }
+      return V;
+    }
+
+  private:
+    static constexpr std::size_t MaxSweeps = 16;
+
+    value_type _w[3]{};
+    value_type _v[9]{};
+  };
+
+  template<typename traits_T, typename ARG>
+  inline EigenSymmetric3x3<traits_T> eigenSymmetric3x3(const ExprBase<traits_T,ARG>& arg)
+  {
+    return EigenSymmetric3x3<traits_T>(arg);
+  }
+
+} // namespace cs
+
+#endif // EIGENSYMMETRIC_H
@@ -32,10 +32,39 @@
 #ifndef EXPRBASE_H
 #define EXPRBASE_H
 
+#include <algorithm>
+#include <cassert>
+
 #include <cs/NumericTraits.h>
 
 namespace cs {
 
+  /*
+   * NOTE:
+   * Expressions store their operands by value, except for leaves holding
+   * data (cf. Array<>), which are stored by reference. Hence an expression
+   * built from temporary sub-expressions remains valid after the
+   * full-expression creating it, e.g. when returned from a function.
+   */
+
+  template<typename T>
+  using operand_t = std::conditional_t<if_leaf_v<T>,const T&,const T>;
+
+  /*
+   * NOTE:
+   * The runtime size of an element-wise expression, cf. DynamicArray<>, is
+   * its operands' size, which is required to be identical. Should they
+   * differ nonetheless, the expression is limited to the common elements,
+   * hence no operand is ever read beyond its end.
+   */
+
+  template<typename LHS, typename RHS>
+  inline std::size_t common_size(const LHS& lhs, const RHS& rhs)
+  {
+    assert(lhs.size() == rhs.size());
+    return std::min<std::size_t>(lhs.size(), rhs.size());
+  }
+
   template<typename traits_T, typename derived_T>
   class ExprBase {
   public:
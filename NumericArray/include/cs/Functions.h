@@ -34,6 +34,7 @@
 
 #include <cs/impl/BinaryOperatorsImpl.h>
 #include <cs/impl/FunctionsImpl.h>
+#include <cs/LU.h>
 #include <cs/Math.h>
 
 namespace cs {
@@ -77,9 +78,18 @@ namespace cs {
   template<typename traits_T, typename ARG>
   inline typename traits_T::value_type determinant(const ExprBase<traits_T,ARG>& arg)
   {
-    static_assert(if_dimensions_v<traits_T,3,3>);
-    using COFACTOR = impl::Cofactor3x3<traits_T,ARG>;
-    return COFACTOR(arg.as_derived()).determinant();
+    static_assert(if_quadratic_v<traits_T>);
+    if constexpr( if_dimensions_v<traits_T,2,2> ) {
+      using ADJUGATE = impl::Adjugate2x2<traits_T,ARG>;
+      return ADJUGATE(arg.as_derived()).determinant();
+    } else if constexpr( if_dimensions_v<traits_T,3,3> ) {
+      using COFACTOR = impl::Cofactor3x3<traits_T,ARG>;
+      return COFACTOR(arg.as_derived()).determinant();
+    } else if constexpr( if_dimensions_v<traits_T,4,4> ) {
+      return impl::BlockInverse4x4<traits_T>(arg.as_derived()).determinant();
+    } else {
+      return LU<traits_T>(arg).determinant();
+    }
   }
 
   // Direction ///////////////////////////////////////////////////////////////
@@ -89,9 +99,10 @@ namespace cs {
                         const ExprBase<traits_T,TO>& to)
   {
     static_assert(if_column_v<traits_T>);
-    using SUB = impl::BinSub<traits_T,TO,FROM>;
-    return impl::BinSDiv<traits_T,SUB>(SUB(to.as_derived(), from.as_derived()),
-                                       length(SUB(to.as_derived(), from.as_derived())));
+    using  SUB = impl::BinSub<traits_T,TO,FROM>;
+    using EVAL = impl::Eval<traits_T,SUB>;
+    const EVAL sub(SUB(to.as_derived(), from.as_derived()));
+    return impl::BinSDiv<traits_T,EVAL>(sub, length(sub));
   }
 
   // Distance ////////////////////////////////////////////////////////////////
@@ -125,17 +136,43 @@ namespace cs {
     return csMax(typename traits_T::value_type{0}, dot(arg1, arg2));
   }
 
+  // Evaluation //////////////////////////////////////////////////////////////
+
+  template<typename traits_T, typename ARG>
+  inline auto eval(const ExprBase<traits_T,ARG>& arg)
+  {
+    return impl::Eval<traits_T,ARG>(arg.as_derived());
+  }
+
   // Inverse /////////////////////////////////////////////////////////////////
 
+  /*
+   * NOTE:
+   * 2x2, 3x3 and 4x4 matrices are inverted in closed form using their
+   * adjugate; larger matrices are inverted using LU<>. Prefer solve() when
+   * only the product of the inverse with a vector is required.
+   */
+
   template<typename traits_T, typename ARG>
   inline auto inverse(const ExprBase<traits_T,ARG>& arg)
   {
-    static_assert(if_dimensions_v<traits_T,3,3>);
-    using  COFACTOR = impl::Cofactor3x3<traits_T,ARG>;
-    using TRANSPOSE = impl::Transpose<traits_T,COFACTOR>;
-    using      SDIV = impl::BinSDiv<traits_T,TRANSPOSE>;
-    return SDIV(TRANSPOSE(COFACTOR(arg.as_derived())),
-                COFACTOR(arg.as_derived()).determinant());
+    static_assert(if_quadratic_v<traits_T>);
+    if constexpr( if_dimensions_v<traits_T,2,2> ) {
+      using ADJUGATE = impl::Adjugate2x2<traits_T,ARG>;
+      using     SDIV = impl::BinSDiv<traits_T,ADJUGATE>;
+      return SDIV(ADJUGATE(arg.as_derived()),
+                  ADJUGATE(arg.as_derived()).determinant());
+    } else if constexpr( if_dimensions_v<traits_T,3,3> ) {
+      using  COFACTOR = impl::Cofactor3x3<traits_T,ARG>;
+      using TRANSPOSE = impl::Transpose<traits_T,COFACTOR>;
+      using      SDIV = impl::BinSDiv<traits_T,TRANSPOSE>;
+      return SDIV(TRANSPOSE(COFACTOR(arg.as_derived())),
+                  COFACTOR(arg.as_derived()).determinant());
+    } else if constexpr( if_dimensions_v<traits_T,4,4> ) {
+      return impl::BlockInverse4x4<traits_T>(arg.as_derived()).inverse();
+    } else {
+      return LU<traits_T>(arg).inverse();
+    }
   }
 
   // Length //////////////////////////////////////////////////////////////////
@@ -156,6 +193,16 @@ namespace cs {
     return impl::SMax<traits_T,ARG>(expr.as_derived(), scalar);
   }
 
+  // Maximum Coefficient /////////////////////////////////////////////////////
+
+  template<typename traits_T, typename ARG>
+  inline typename traits_T::value_type maxCoeff(const ExprBase<traits_T,ARG>& arg)
+  {
+    using     OP = impl::ReduceMax<typename traits_T::value_type>;
+    using REDUCE = impl::Reduce<traits_T,OP,ARG>;
+    return REDUCE::run(arg.as_derived());
+  }
+
   // Minimum /////////////////////////////////////////////////////////////////
 
   template<typename traits_T, typename ARG>
@@ -165,14 +212,65 @@ namespace cs {
     return impl::SMin<traits_T,ARG>(expr.as_derived(), scalar);
   }
 
+  // Minimum Coefficient /////////////////////////////////////////////////////
+
+  template<typename traits_T, typename ARG>
+  inline typename traits_T::value_type minCoeff(const ExprBase<traits_T,ARG>& arg)
+  {
+    using     OP = impl::ReduceMin<typename traits_T::value_type>;
+    using REDUCE = impl::Reduce<traits_T,OP,ARG>;
+    return REDUCE::run(arg.as_derived());
+  }
+
+  // Norms ///////////////////////////////////////////////////////////////////
+
+  template<typename traits_T, typename ARG>
+  inline typename traits_T::value_type normInf(const ExprBase<traits_T,ARG>& arg)
+  {
+    using     OP = impl::ReduceMaxAbs<typename traits_T::value_type>;
+    using REDUCE = impl::Reduce<traits_T,OP,ARG>;
+    return REDUCE::run(arg.as_derived());
+  }
+
+  template<typename traits_T, typename ARG>
+  inline typename traits_T::value_type normL1(const ExprBase<traits_T,ARG>& arg)
+  {
+    using     OP = impl::ReduceSumAbs<typename traits_T::value_type>;
+    using REDUCE = impl::Reduce<traits_T,OP,ARG>;
+    return REDUCE::run(arg.as_derived());
+  }
+
+  template<typename traits_T, typename ARG>
+  inline typename traits_T::value_type squaredNorm(const ExprBase<traits_T,ARG>& arg)
+  {
+    using     OP = impl::ReduceSumSquares<typename traits_T::value_type>;
+    using REDUCE = impl::Reduce<traits_T,OP,ARG>;
+    return REDUCE::run(arg.as_derived());
+  }
+
+  // Sum /////////////////////////////////////////////////////////////////////
+
+  template<typename traits_T, typename ARG>
+  inline typename traits_T::value_type sum(const ExprBase<traits_T,ARG>& arg)
+  {
+    using     OP = impl::ReduceSum<typename traits_T::value_type>;
+    using REDUCE = impl::Reduce<traits_T,OP,ARG>;
+    return REDUCE::run(arg.as_derived());
+  }
+
   // Vector Normalization ////////////////////////////////////////////////////
 
   template<typename traits_T, typename ARG>
   inline auto normalize(const ExprBase<traits_T,ARG>& arg)
   {
     static_assert(if_column_v<traits_T>);
-    return impl::BinSDiv<traits_T,ARG>(arg.as_derived(),
-                                       length(arg.as_derived()));
+    if constexpr( if_leaf_v<ARG> ) {
+      return impl::BinSDiv<traits_T,ARG>(arg.as_derived(), length(arg.as_derived()));
+    } else {
+      using EVAL = impl::Eval<traits_T,ARG>;
+      const EVAL value(arg.as_derived());
+      return impl::BinSDiv<traits_T,EVAL>(value, length(value));
+    }
   }
 
   // Vector/Matrix Transposition /////////////////////////////////////////////
@@ -0,0 +1,143 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <cstddef>
+
+#include <type_traits>
+
+#include <cs/impl/TargetImpl.h>
+#include <cs/CPU.h>
+#include <cs/SIMD.h>
+
+////// Kernels - SSE2 ////////////////////////////////////////////////////////
+
+#define CS_KERNELS_NAMESPACE  sse2
+#define CS_KERNELS_SIMD       SIMD128
+#define CS_KERNELS_FMA        0
+#include <cs/impl/KernelsImpl.h>
+#undef CS_KERNELS_NAMESPACE
+#undef CS_KERNELS_SIMD
+#undef CS_KERNELS_FMA
+
+////// Kernels - AVX2 ////////////////////////////////////////////////////////
+
+CS_TARGET_PUSH("avx2,fma")
+#define CS_KERNELS_NAMESPACE  avx2
+#define CS_KERNELS_SIMD       SIMD256
+#define CS_KERNELS_FMA        1
+#include <cs/impl/KernelsImpl.h>
+#undef CS_KERNELS_NAMESPACE
+#undef CS_KERNELS_SIMD
+#undef CS_KERNELS_FMA
+CS_TARGET_POP()
+
+////// Kernels - AVX-512 /////////////////////////////////////////////////////
+
+CS_TARGET_PUSH("avx512f,avx2,fma")
+#define CS_KERNELS_NAMESPACE  avx512
+#define CS_KERNELS_SIMD       SIMD512
+#define CS_KERNELS_FMA        1
+#include <cs/impl/KernelsImpl.h>
+#undef CS_KERNELS_NAMESPACE
+#undef CS_KERNELS_SIMD
+#undef CS_KERNELS_FMA
+CS_TARGET_POP()
+
+namespace cs {
+
+  ////// Kernel Table ////////////////////////////////////////////////////////
+
+  template<typename T>
+  struct KernelTable {
+    void (*assign)(T *dest, const T value, const std::size_t count);
+    void (*copy)(T *dest, const T *src, const std::size_t count);
+    T    (*dot)(const T *a, const T *b, const std::size_t count);
+  };
+
+  namespace kernels {
+
+    namespace impl {
+
+      template<typename KERNELS>
+      inline auto make_table()
+      {
+        using value_type = typename KERNELS::value_type;
+        return KernelTable<value_type>{&KERNELS::assign, &KERNELS::copy, &KERNELS::dot};
+      }
+
+    } // namespace impl
+
+    template<typename T>
+    inline KernelTable<T> table(const ISA isa)
+    {
+      if(        isa == ISA::AVX512 ) {
+        return impl::make_table<cs::impl::avx512::Kernels<T>>();
+      } else if( isa == ISA::AVX2 ) {
+        return impl::make_table<cs::impl::avx2::Kernels<T>>();
+      }
+      return impl::make_table<cs::impl::sse2::Kernels<T>>();
+    }
+
+    template<typename T>
+    inline const KernelTable<T>& dispatch()
+    {
+      static const KernelTable<T> kernels = table<T>(dispatchISA());
+      return kernels;
+    }
+
+    ////// User Interface ////////////////////////////////////////////////////
+
+    template<typename T>
+    inline void assign(T *dest, const T value, const std::size_t count)
+    {
+      dispatch<T>().assign(dest, value, count);
+    }
+
+    template<typename T>
+    inline void copy(T *dest, const T *src, const std::size_t count)
+    {
+      dispatch<T>().copy(dest, src, count);
+    }
+
+    template<typename T>
+    inline T dot(const T *a, const T *b, const std::size_t count)
+    {
+      return dispatch<T>().dot(a, b, count);
+    }
+
+  } // namespace kernels
+
+} // namespace cs
+
+#endif // KERNELS_H
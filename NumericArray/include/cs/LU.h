@@ -0,0 +1,204 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef LU_H
+#define LU_H
+
+#include <type_traits>
+
+#include <cs/impl/LUImpl.h>
+#include <cs/Array.h>
+#include <cs/ArrayPolicy.h>
+#include <cs/ExprBase.h>
+#include <cs/Manipulator.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  /*
+   * NOTE:
+   * LU<> factors a quadratic matrix A into P*A = L*U using partial (row)
+   * pivoting, where L has a unit diagonal. The factorization is unrolled at
+   * compile time; rows are eliminated blockwise using SIMD. Solving a system
+   * by substitution is both cheaper and more accurate than multiplying with
+   * an explicit inverse.
+   */
+
+  template<typename traits_T>
+  class LU {
+  public:
+    using traits_type = traits_T;
+    using  value_type = typename traits_type::value_type;
+    using  array_type = Array<NoManipulator<RowMajorPolicy<traits_type>>>;
+    using        simd = SIMD<value_type>;
+
+    static_assert(if_quadratic_v<traits_type>);
+
+    template<typename ARG>
+    LU(const ExprBase<traits_type,ARG>& arg) noexcept
+    {
+      using LOAD = impl::LULoad<traits_type,ARG>;
+      meta::for_each<traits_type::Size,LOAD>(_u, arg.as_derived());
+
+      for(std::size_t i = 0; i < N; i++) {
+        _perm[i] = i;
+      }
+
+      using DECOMPOSE = impl::LUDecompose<traits_type>;
+      meta::for_each<N,DECOMPOSE>(_l, _u, _perm, _sign);
+    }
+
+    ~LU() noexcept = default;
+
+    // Results ///////////////////////////////////////////////////////////////
+
+    value_type determinant() const
+    {
+      using DIAGONAL = impl::LUDiagonal<traits_type>;
+      return _sign*meta::accumulate<value_type,N,DIAGONAL>(_u);
+    }
+
+    array_type inverse() const
+    {
+      array_type result;
+      for(std::size_t j = 0; j < N; j++) {
+        value_type x[N];
+        for(std::size_t i = 0; i < N; i++) {
+          x[i] = _perm[i] == j
+              ? value_type{1}
+              : value_type{0};
+        }
+
+        substitute(x);
+
+        for(std::size_t i = 0; i < N; i++) {
+          result(i, j) = x[i];
+        }
+      }
+      return result;
+    }
+
+    template<typename rhs_T, typename ARG>
+    Array<NoManipulator<RowMajorPolicy<rhs_T>>> solve(const ExprBase<rhs_T,ARG>& rhs) const
+    {
+      static_assert(std::is_same_v<typename rhs_T::value_type,value_type>  &&
+                    rhs_T::Rows == N);
+      using rhs_type = Array<NoManipulator<RowMajorPolicy<rhs_T>>>;
+
+      const rhs_type b(rhs);
+
+      rhs_type result;
+      for(std::size_t j = 0; j < rhs_T::Columns; j++) {
+        value_type x[N];
+        for(std::size_t i = 0; i < N; i++) {
+          x[i] = b(_perm[i], j);
+        }
+
+        substitute(x);
+
+        for(std::size_t i = 0; i < N; i++) {
+          result(i, j) = x[i];
+        }
+      }
+      return result;
+    }
+
+    // Factors ///////////////////////////////////////////////////////////////
+
+    array_type matrixL() const
+    {
+      array_type L;
+      for(std::size_t i = 0; i < N; i++) {
+        for(std::size_t j = 0; j < i; j++) {
+          L(i, j) = _l[i*Stride + j];
+        }
+        L(i, i) = value_type{1};
+      }
+      return L;
+    }
+
+    array_type matrixU() const
+    {
+      array_type U;
+      for(std::size_t i = 0; i < N; i++) {
+        for(std::size_t j = i; j < N; j++) {
+          U(i, j) = _u[i*Stride + j];
+        }
+      }
+      return U;
+    }
+
+    /*
+     * NOTE:
+     * Row i of P*A equals row permutation(i) of A.
+     */
+    std::size_t permutation(const std::size_t i) const
+    {
+      return _perm[i];
+    }
+
+  private:
+    static constexpr std::size_t      N = impl::LUStorage<traits_type>::N;
+    static constexpr std::size_t Stride = impl::LUStorage<traits_type>::Stride;
+
+    inline void substitute(value_type *x) const
+    {
+      using  FORWARD = impl::LUForward<traits_type>;
+      using BACKWARD = impl::LUBackward<traits_type>;
+      meta::for_each<N,FORWARD>(_l, x);
+      meta::for_each<N,BACKWARD>(_u, x);
+    }
+
+    alignas(simd::Alignment) value_type _l[N*Stride]{};
+    alignas(simd::Alignment) value_type _u[N*Stride]{};
+    std::size_t _perm[N]{};
+    value_type _sign{1};
+  };
+
+  // Decomposition ///////////////////////////////////////////////////////////
+
+  template<typename traits_T, typename ARG>
+  inline LU<traits_T> lu(const ExprBase<traits_T,ARG>& arg)
+  {
+    return LU<traits_T>(arg);
+  }
+
+  // Solve ///////////////////////////////////////////////////////////////////
+
+  template<typename traits_T, typename rhs_T, typename ARG, typename RHS>
+  inline auto solve(const ExprBase<traits_T,ARG>& A, const ExprBase<rhs_T,RHS>& b)
+  {
+    return LU<traits_T>(A).solve(b);
+  }
+
+} // namespace cs
+
+#endif // LU_H
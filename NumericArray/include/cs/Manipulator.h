@@ -32,11 +32,23 @@
 #ifndef MANIPULATOR_H
 #define MANIPULATOR_H
 
+#include <cs/impl/ArrayImpl.h>
 #include <cs/Math.h>
 #include <cs/NumericTraits.h>
 
 namespace cs {
 
+  /*
+   * NOTE:
+   * A manipulator provides the storage of an Array<>. Its properties are
+   * overlaid onto this storage through an anonymous union; they hold no
+   * state of their own and access their element relative to their own
+   * address. Hence Array<> is trivially copyable and as large as its data.
+   *
+   * Properties only convert from and to value_type; assigning one property
+   * to another of the same type copies nothing.
+   */
+
   ////// No Data Manipulator /////////////////////////////////////////////////
 
   template<typename policy_T>
@@ -48,14 +60,12 @@ namespace cs {
 
     static_assert(if_traits_v<traits_type>);
 
-    NoManipulator(value_type *) noexcept
-    {
-    }
+    NoManipulator() noexcept = default;
 
     ~NoManipulator() noexcept = default;
 
-  private:
-    NoManipulator() noexcept = delete;
+  protected:
+    value_type _data[impl::ArrayStorage<traits_type>::DataSize];
   };
 
 
@@ -70,28 +80,31 @@ namespace cs {
 
     static_assert(if_index_v<traits_type,i,j>);
 
-    ArrayProperty(value_type *data) noexcept
-      : _data{&data[policy_type::index(i, j)]}
-    {
-    }
+    ArrayProperty() noexcept = default;
 
     ~ArrayProperty() noexcept = default;
 
     inline operator value_type() const
     {
-      return *_data;
+      return data()[policy_type::index(i, j)];
     }
 
     inline value_type operator=(const value_type value)
     {
-      *_data = value;
-      return *_data;
+      data()[policy_type::index(i, j)] = value;
+      return data()[policy_type::index(i, j)];
     }
 
   private:
-    ArrayProperty() noexcept = delete;
+    inline const value_type *data() const
+    {
+      return reinterpret_cast<const value_type*>(this);
+    }
 
-    value_type *_data{nullptr};
+    inline value_type *data()
+    {
+      return reinterpret_cast<value_type*>(this);
+    }
   };
 
 
@@ -107,10 +120,7 @@ namespace cs {
 
     static_assert(if_index_v<traits_type,i,0>);
 
-    RGBProperty(value_type *data) noexcept
-      : _data{&data[policy_type::index(i, 0)]}
-    {
-    }
+    RGBProperty() noexcept = default;
 
     ~RGBProperty() noexcept = default;
 
@@ -118,21 +128,27 @@ namespace cs {
     {
       constexpr value_type  ONE = 1;
       constexpr value_type ZERO = 0;
-      return static_cast<rgb_type>(csClamp(*_data, ZERO, ONE)*RGB_MAX);
+      return static_cast<rgb_type>(csClamp(data()[policy_type::index(i, 0)], ZERO, ONE)*RGB_MAX);
     }
 
     inline rgb_type operator=(const rgb_type value)
     {
-      *_data = static_cast<value_type>(value)/RGB_MAX;
+      data()[policy_type::index(i, 0)] = static_cast<value_type>(value)/RGB_MAX;
       return operator rgb_type();
     }
 
   private:
     static constexpr value_type RGB_MAX = 255;
 
-    RGBProperty() noexcept = delete;
+    inline const value_type *data() const
+    {
+      return reinterpret_cast<const value_type*>(this);
+    }
 
-    value_type *_data{nullptr};
+    inline value_type *data()
+    {
+      return reinterpret_cast<value_type*>(this);
+    }
   };
 
   template<typename policy_T>
@@ -144,21 +160,17 @@ namespace cs {
 
     static_assert(if_dimensions_v<traits_type,3,1>);
 
-    Color3Manip(value_type *data) noexcept
-      : r(data)
-      , g(data)
-      , b(data)
-    {
-    }
+    Color3Manip() noexcept = default;
 
     ~Color3Manip() noexcept = default;
 
-    RGBProperty<policy_T,0> r;
-    RGBProperty<policy_T,1> g;
-    RGBProperty<policy_T,2> b;
+    union {
+      value_type _data[impl::ArrayStorage<traits_type>::DataSize];
 
-  private:
-    Color3Manip() noexcept = delete;
+      RGBProperty<policy_T,0> r;
+      RGBProperty<policy_T,1> g;
+      RGBProperty<policy_T,2> b;
+    };
   };
 
 
@@ -173,21 +185,17 @@ namespace cs {
 
     static_assert(if_dimensions_v<traits_type,3,1>);
 
-    Vector3Manip(value_type *data) noexcept
-      : x(data)
-      , y(data)
-      , z(data)
-    {
-    }
+    Vector3Manip() noexcept = default;
 
     ~Vector3Manip() noexcept = default;
 
-    ArrayProperty<policy_type,0,0> x;
-    ArrayProperty<policy_type,1,0> y;
-    ArrayProperty<policy_type,2,0> z;
+    union {
+      value_type _data[impl::ArrayStorage<traits_type>::DataSize];
 
-  private:
-    Vector3Manip() noexcept = delete;
+      ArrayProperty<policy_type,0,0> x;
+      ArrayProperty<policy_type,1,0> y;
+      ArrayProperty<policy_type,2,0> z;
+    };
   };
 
 } // namespace cs
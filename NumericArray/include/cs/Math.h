@@ -93,6 +93,18 @@ inline float csClamp(const float& v, const float& lo, const float& hi)
   return _mm_cvtss_f32(_mm_max_ss(_mm_set_ss(lo), _mm_min_ss(_mm_set_ss(v), _mm_set_ss(hi))));
 }
 
+////// Copy Sign /////////////////////////////////////////////////////////////
+
+inline double csCopySign(const double& x, const double& s)
+{
+  return ::copysign(x, s);
+}
+
+inline float csCopySign(const float& x, const float& s)
+{
+  return ::copysignf(x, s);
+}
+
 ////// Min & Max /////////////////////////////////////////////////////////////
 
 inline double csMax(const double& a, const double& b)
@@ -139,6 +151,22 @@ inline float csRemndr(const float& x, const float& y)
   return ::fmodf(x, y);
 }
 
+////// Selection /////////////////////////////////////////////////////////////
+
+inline double csSelectLess(const double& a, const double& b, const double& x, const double& y)
+{
+  return a < b
+      ? x
+      : y;
+}
+
+inline float csSelectLess(const float& a, const float& b, const float& x, const float& y)
+{
+  return a < b
+      ? x
+      : y;
+}
+
 ////// Square Root ///////////////////////////////////////////////////////////
 
 inline double csInvSqrt(const double& x)
@@ -33,12 +33,18 @@
 #define NUMERICARRAY_H
 
 #include <cs/Array.h>
+#include <cs/ArrayMap.h>
 #include <cs/ArrayPolicy.h>
 #include <cs/ArrayTraits.h>
 #include <cs/BinaryOperators.h>
+#include <cs/Cholesky.h>
+#include <cs/EigenSymmetric.h>
 #include <cs/Functions.h>
 #include <cs/Geometry.h>
+#include <cs/LU.h>
 #include <cs/Manipulator.h>
+#include <cs/QR.h>
+#include <cs/SVD.h>
 #include <cs/UnaryOperators.h>
 
 namespace cs {
@@ -46,6 +52,12 @@ namespace cs {
   template<typename value_T, std::size_t ROWS, std::size_t COLS>
   using NumericArray = Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_T,ROWS,COLS>>>>;
 
+  template<typename value_T, std::size_t ROWS, std::size_t COLS>
+  using NumericArrayMap = ArrayMap<RowMajorPolicy<ArrayTraits<value_T,ROWS,COLS>>>;
+
+  template<typename value_T, std::size_t ROWS, std::size_t COLS>
+  using NumericArrayView = ArrayView<RowMajorPolicy<ArrayTraits<value_T,ROWS,COLS>>>;
+
 } // namespace cs
 
 #endif // NUMERICARRAY_H
@@ -36,22 +36,49 @@
 
 namespace cs {
 
+  // traits_type::value_type is a SIMD packet; cf. ArrayBatch<> //////////////
+
+  template<typename T, typename = bool>
+  struct if_packet : std::false_type {};
+
+  template<typename T>
+  struct if_packet<T,decltype((void)T::is_packet,bool())>
+      : std::bool_constant<T::is_packet> {};
+
+  template<typename T>
+  inline constexpr bool if_packet_v = if_packet<T>::value;
+
+
   // traits_type::value_type /////////////////////////////////////////////////
 
   template<typename T>
-  inline constexpr bool if_value_v = std::is_floating_point_v<T>;
+  inline constexpr bool if_value_v = std::is_floating_point_v<T>  ||  if_packet_v<T>;
 
   template<typename T>
   using if_value_t = std::enable_if_t<if_value_v<T>,T>;
 
 
+  // traits_type represents a dynamic-size array ////////////////////////////
+
+  template<typename traits_T, typename = bool>
+  struct if_dynamic : std::false_type {};
+
+  template<typename traits_T>
+  struct if_dynamic<traits_T,decltype((void)traits_T::Dynamic,bool())>
+      : std::bool_constant<traits_T::Dynamic> {};
+
+  template<typename traits_T>
+  inline constexpr bool if_dynamic_v = if_dynamic<traits_T>::value;
+
+
   // traits_type /////////////////////////////////////////////////////////////
 
   template<typename traits_T>
   inline constexpr bool if_traits_v = std::is_class_v<traits_T>  &&
       if_value_v<typename traits_T::value_type>  &&
-      traits_T::Columns > 0  &&  traits_T::Rows > 0  &&
-      traits_T::Columns*traits_T::Rows == traits_T::Size;
+      ( if_dynamic_v<traits_T>  ||
+        ( traits_T::Columns > 0  &&  traits_T::Rows > 0  &&
+          traits_T::Columns*traits_T::Rows == traits_T::Size ) );
 
   template<typename traits_T, typename T>
   using if_traits_t = std::enable_if_t<if_traits_v<traits_T>,T>;
@@ -131,6 +158,41 @@ namespace cs {
     return false;
   }
 
+  // Leaf of an expression holding data; cf. Array<> ///////////////////////
+
+  template<typename T, typename = bool>
+  struct if_leaf : std::false_type {};
+
+  template<typename T>
+  struct if_leaf<T,decltype((void)T::is_leaf,bool())>
+      : std::bool_constant<T::is_leaf> {};
+
+  template<typename T>
+  inline constexpr bool if_leaf_v = if_leaf<T>::value;
+
+  // Expression reads its operands in non-elementwise order ////////////////
+
+  template<typename T, typename = bool>
+  struct if_reordering : std::false_type {};
+
+  template<typename T>
+  struct if_reordering<T,decltype((void)T::is_reordering,bool())>
+      : std::bool_constant<T::is_reordering> {};
+
+  template<typename T>
+  inline constexpr bool if_reordering_v = if_reordering<T>::value;
+
+  // Fused multiply-add availability /////////////////////////////////////////
+
+  template<typename T, typename = bool>
+  struct if_fma : std::false_type {};
+
+  template<typename T>
+  struct if_fma<T,decltype((void)T::have_fma,bool())> : std::true_type {};
+
+  template<typename T>
+  inline constexpr bool if_fma_v = if_fma<T>::value;
+
   // RGB types ///////////////////////////////////////////////////////////////
 
   template<typename T>
@@ -0,0 +1,172 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef QR_H
+#define QR_H
+
+#include <type_traits>
+
+#include <cs/impl/QRImpl.h>
+#include <cs/Array.h>
+#include <cs/ArrayPolicy.h>
+#include <cs/ArrayTraits.h>
+#include <cs/ExprBase.h>
+#include <cs/Manipulator.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  /*
+   * NOTE:
+   * QR<> factors an MxN matrix A (M >= N) into Q*R using Householder
+   * reflections, where Q is orthogonal and R is upper triangular. solve()
+   * yields the least-squares solution of an overdetermined system; A is
+   * required to have full column rank.
+   */
+
+  template<typename traits_T>
+  class QR {
+  public:
+    using traits_type = traits_T;
+    using  value_type = typename traits_type::value_type;
+    using  array_type = Array<NoManipulator<RowMajorPolicy<traits_type>>>;
+    using      q_type = Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_type,traits_type::Rows,traits_type::Rows>>>>;
+
+    static_assert(traits_type::Rows >= traits_type::Columns);
+
+    template<typename ARG>
+    QR(const ExprBase<traits_type,ARG>& arg) noexcept
+    {
+      using LOAD = impl::QRLoad<N,ARG>;
+      meta::for_each<traits_type::Size,LOAD>(_qr, arg.as_derived());
+
+      using COLUMN = impl::QRColumn<value_type,M,N>;
+      meta::for_each<N,COLUMN>(_qr, _tau);
+    }
+
+    ~QR() noexcept = default;
+
+    // Results ///////////////////////////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * Each non-trivial reflection has a determinant of -1.
+     */
+    value_type determinant() const
+    {
+      static_assert(if_quadratic_v<traits_type>);
+      value_type result{1};
+      for(std::size_t i = 0; i < N; i++) {
+        result *= _tau[i] != value_type{0}
+            ? -_qr[i*N + i]
+            : _qr[i*N + i];
+      }
+      return result;
+    }
+
+    template<typename rhs_T, typename ARG>
+    Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_type,traits_type::Columns,rhs_T::Columns>>>>
+    solve(const ExprBase<rhs_T,ARG>& rhs) const
+    {
+      static_assert(std::is_same_v<typename rhs_T::value_type,value_type>  &&
+                    rhs_T::Rows == M);
+      using    APPLY = impl::QRApplyTransposed<value_type,M,N>;
+      using BACKWARD = impl::UpperBackward<value_type,N>;
+
+      const Array<NoManipulator<RowMajorPolicy<rhs_T>>> b(rhs);
+
+      Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_type,N,rhs_T::Columns>>>> result;
+      for(std::size_t j = 0; j < rhs_T::Columns; j++) {
+        value_type x[M];
+        for(std::size_t i = 0; i < M; i++) {
+          x[i] = b(i, j);
+        }
+
+        meta::for_each<N,APPLY>(_qr, _tau, x);
+        meta::for_each<N,BACKWARD>(_qr, x);
+
+        for(std::size_t i = 0; i < N; i++) {
+          result(i, j) = x[i];
+        }
+      }
+      return result;
+    }
+
+    // Factors ///////////////////////////////////////////////////////////////
+
+    q_type matrixQ() const
+    {
+      using APPLY = impl::QRApply<value_type,M,N>;
+
+      q_type Q;
+      for(std::size_t j = 0; j < M; j++) {
+        value_type x[M]{};
+        x[j] = value_type{1};
+
+        meta::for_each<N,APPLY>(_qr, _tau, x);
+
+        for(std::size_t i = 0; i < M; i++) {
+          Q(i, j) = x[i];
+        }
+      }
+      return Q;
+    }
+
+    array_type matrixR() const
+    {
+      array_type R;
+      for(std::size_t i = 0; i < N; i++) {
+        for(std::size_t j = i; j < N; j++) {
+          R(i, j) = _qr[i*N + j];
+        }
+      }
+      return R;
+    }
+
+  private:
+    static constexpr std::size_t M = traits_type::Rows;
+    static constexpr std::size_t N = traits_type::Columns;
+
+    value_type _qr[M*N]{};
+    value_type _tau[N]{};
+  };
+
+  // Decomposition ///////////////////////////////////////////////////////////
+
+  template<typename traits_T, typename ARG>
+  inline QR<traits_T> qr(const ExprBase<traits_T,ARG>& arg)
+  {
+    return QR<traits_T>(arg);
+  }
+
+} // namespace cs
+
+#endif // QR_H
@@ -32,196 +32,83 @@
 #ifndef SIMD_H
 #define SIMD_H
 
-#include <cstddef>
-
-#include <emmintrin.h> // SSE2
-#include <xmmintrin.h> // SSE
+#include <cs/impl/SIMD128Impl.h>
+#include <cs/impl/SIMD256Impl.h>
+#include <cs/impl/SIMD512Impl.h>
+#include <cs/NumericTraits.h>
+
+/*
+ * NOTE:
+ * The SIMD backend is selected at compile time by defining CS_SIMD_WIDTH
+ * to either 128 (SSE2), 256 (AVX) or 512 (AVX-512). If left undefined,
+ * the widest backend supported by the compiler's target architecture is used.
+ *
+ * All backends are always declared; cf. cs/Kernels.h for kernels selecting
+ * their backend at runtime.
+ */
+
+#if !defined(CS_SIMD_WIDTH)
+# if defined(__AVX512F__)
+#  define CS_SIMD_WIDTH 512
+# elif defined(__AVX__)
+#  define CS_SIMD_WIDTH 256
+# else
+#  define CS_SIMD_WIDTH 128
+# endif
+#endif
+
+#if CS_SIMD_WIDTH == 256
+# if !defined(__AVX__)
+#  error "CS_SIMD_WIDTH == 256 requires AVX!"
+# endif
+#elif CS_SIMD_WIDTH == 512
+# if !defined(__AVX512F__)
+#  error "CS_SIMD_WIDTH == 512 requires AVX-512!"
+# endif
+#elif CS_SIMD_WIDTH != 128
+# error "Invalid CS_SIMD_WIDTH!"
+#endif
 
 namespace cs {
 
-  ////// Macros //////////////////////////////////////////////////////////////
+  ////// Backend Selection ///////////////////////////////////////////////////
+
+#if CS_SIMD_WIDTH == 512
+  template<typename T>
+  using SIMD = SIMD512<T>;
+#elif CS_SIMD_WIDTH == 256
+  template<typename T>
+  using SIMD = SIMD256<T>;
+#else
+  template<typename T>
+  using SIMD = SIMD128<T>;
+#endif
 
-#define SIMD_SHUFFLE_PD(x,fp1,fp0)                                                   \
-  _mm_castsi128_pd(_mm_shuffle_epi32(_mm_castpd_si128(x),                            \
-                                     _MM_SHUFFLE((((fp1) << 1) + 1), ((fp1) << 1),   \
-                                                 (((fp0) << 1) + 1), ((fp0) << 1))))
+  template<typename T>
+  using SIMDtraits = typename SIMD<T>::simd_traits;
 
-#define SIMD_SHUFFLE_PS(x,fp3,fp2,fp1,fp0) \
-  _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(x), _MM_SHUFFLE((fp3), (fp2), (fp1), (fp0))))
+  /*
+   * NOTE:
+   * Expression nodes declare block() for any value_type; packet value types
+   * (cf. ArrayBatch<>) never evaluate blocks, but map to their register type.
+   */
 
-  ////// Traits //////////////////////////////////////////////////////////////
+  namespace impl {
 
-  template<typename T>
-  struct SIMDtraits {
-    // SFINAE
-  };
-
-  template<>
-  struct SIMDtraits<double> {
-    using  simd_type = __m128d;
-    using value_type = double;
-
-    inline static __m128d zero()
-    {
-      return _mm_setzero_pd();
-    }
-  };
-
-  template<>
-  struct SIMDtraits<float> {
-    using  simd_type = __m128;
-    using value_type = float;
-
-    inline static __m128 zero()
-    {
-      return _mm_setzero_ps();
-    }
-  };
+    template<typename T, bool = if_packet_v<T>>
+    struct SIMDtype {
+      using type = typename SIMD<T>::simd_type;
+    };
 
-  template<typename T>
-  using simd_type = typename SIMDtraits<T>::simd_type;
+    template<typename T>
+    struct SIMDtype<T,true> {
+      using type = typename T::simd_type;
+    };
 
-  ////// Implementation //////////////////////////////////////////////////////
+  } // namespace impl
 
   template<typename T>
-  struct SIMD {
-    using  simd_traits = SIMDtraits<T>;
-    using  simd_type   = typename simd_traits::simd_type;
-    using value_type   = typename simd_traits::value_type;
-
-    static inline constexpr std::size_t    Alignment = sizeof(simd_type);
-    static inline constexpr std::size_t ElementCount = sizeof(simd_type)/sizeof(value_type);
-
-    inline static constexpr std::size_t blocks(const std::size_t count)
-    {
-      return (count + ElementCount - 1)/ElementCount;
-    }
-
-    inline static constexpr std::size_t size(const std::size_t count)
-    {
-      return blocks(count)*ElementCount;
-    }
-
-    inline static simd_type zero()
-    {
-      return simd_traits::zero();
-    }
-
-    // Interface - double ////////////////////////////////////////////////////
-
-    inline static __m128d load(const double *src)
-    {
-      return _mm_load_pd(src);
-    }
-
-    inline static __m128d set(const double& x)
-    {
-      return _mm_set1_pd(x);
-    }
-
-    inline static void store(double *dest, const __m128d& x)
-    {
-      _mm_store_pd(dest, x);
-    }
-
-    inline static __m128d add(const __m128d& a, const __m128d& b)
-    {
-      return _mm_add_pd(a, b);
-    }
-
-    inline static __m128d sub(const __m128d& a, const __m128d& b)
-    {
-      return _mm_sub_pd(a, b);
-    }
-
-    inline static __m128d mul(const __m128d& a, const __m128d& b)
-    {
-      return _mm_mul_pd(a, b);
-    }
-
-    inline static __m128d div(const __m128d& a, const __m128d& b)
-    {
-      return _mm_div_pd(a, b);
-    }
-
-    inline static __m128d min(const __m128d& a, const __m128d& b)
-    {
-      return _mm_min_pd(a, b);
-    }
-
-    inline static __m128d max(const __m128d& a, const __m128d& b)
-    {
-      return _mm_max_pd(a, b);
-    }
-
-    inline static double scalar(const __m128d& x)
-    {
-      return _mm_cvtsd_f64(x);
-    }
-
-    inline static __m128d hadd(const __m128d& x)
-    {
-      return _mm_add_pd(x, SIMD_SHUFFLE_PD(x, 0, 1));
-    }
-
-    // Interface - float /////////////////////////////////////////////////////
-
-    inline static __m128 load(const float *src)
-    {
-      return _mm_load_ps(src);
-    }
-
-    inline static __m128 set(const float& x)
-    {
-      return _mm_set1_ps(x);
-    }
-
-    inline static void store(float *dest, const __m128& x)
-    {
-      _mm_store_ps(dest, x);
-    }
-
-    inline static __m128 add(const __m128& a, const __m128& b)
-    {
-      return _mm_add_ps(a, b);
-    }
-
-    inline static __m128 sub(const __m128& a, const __m128& b)
-    {
-      return _mm_sub_ps(a, b);
-    }
-
-    inline static __m128 mul(const __m128& a, const __m128& b)
-    {
-      return _mm_mul_ps(a, b);
-    }
-
-    inline static __m128 div(const __m128& a, const __m128& b)
-    {
-      return _mm_div_ps(a, b);
-    }
-
-    inline static __m128 min(const __m128& a, const __m128& b)
-    {
-      return _mm_min_ps(a, b);
-    }
-
-    inline static __m128 max(const __m128& a, const __m128& b)
-    {
-      return _mm_max_ps(a, b);
-    }
-
-    inline static float scalar(const __m128& x)
-    {
-      return _mm_cvtss_f32(x);
-    }
-
-    inline static __m128 hadd(const __m128& x)
-    {
-      const __m128 temp = _mm_add_ps(x,    SIMD_SHUFFLE_PS(x,    2, 3, 0, 1));
-      return              _mm_add_ps(temp, SIMD_SHUFFLE_PS(temp, 0, 1, 2, 3));
-    }
-  };
+  using simd_type = typename impl::SIMDtype<T>::type;
 
 } // namespace cs
 
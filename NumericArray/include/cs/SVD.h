@@ -0,0 +1,249 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef SVD_H
+#define SVD_H
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <cs/impl/SVDImpl.h>
+#include <cs/Array.h>
+#include <cs/ArrayPolicy.h>
+#include <cs/ArrayTraits.h>
+#include <cs/ExprBase.h>
+#include <cs/Manipulator.h>
+#include <cs/Math.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  /*
+   * NOTE:
+   * SVD<> factors an MxN matrix A (M >= N) into U*diag(s)*transpose(V)
+   * using one-sided Jacobi rotations, where U is MxN with orthonormal
+   * columns, V is orthogonal and the singular values s are sorted in
+   * descending order. Columns of U belonging to a zero singular value are
+   * zero. A wide matrix is decomposed by transposing it first.
+   */
+
+  template<typename traits_T>
+  class SVD {
+  public:
+    using traits_type = traits_T;
+    using  value_type = typename traits_type::value_type;
+    using  array_type = Array<NoManipulator<RowMajorPolicy<traits_type>>>;
+    using      v_type = Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_type,traits_type::Columns,traits_type::Columns>>>>;
+    using vector_type = Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_type,traits_type::Columns,1>>>>;
+
+    static_assert(traits_type::Rows >= traits_type::Columns);
+
+    static constexpr std::size_t MaxSweeps = 32;
+
+    template<typename ARG>
+    SVD(const ExprBase<traits_type,ARG>& arg) noexcept
+    {
+      using LOAD = impl::SVDLoad<N,ARG>;
+      meta::for_each<traits_type::Size,LOAD>(_u, arg.as_derived());
+
+      for(std::size_t i = 0; i < N; i++) {
+        _v[i*N + i] = value_type{1};
+      }
+
+      using ROTATE = impl::SVDRotate<value_type,M,N>;
+      const value_type tol = value_type(M)*std::numeric_limits<value_type>::epsilon();
+      for(std::size_t sweep = 0; sweep < MaxSweeps; sweep++) {
+        bool rotated = false;
+        meta::for_each<N*N,ROTATE>(_u, _v, tol, rotated);
+        if( !rotated ) {
+          break;
+        }
+      }
+
+      finish();
+    }
+
+    ~SVD() noexcept = default;
+
+    // Results ///////////////////////////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * Singular values below M*epsilon*s(0) are considered zero.
+     */
+    std::size_t rank() const
+    {
+      const value_type tol = threshold();
+      std::size_t result = 0;
+      for(std::size_t i = 0; i < N; i++) {
+        if( _s[i] > tol ) {
+          result++;
+        }
+      }
+      return result;
+    }
+
+    /*
+     * NOTE:
+     * Yields the minimum norm least-squares solution, i.e. the product of
+     * the pseudo-inverse of A with rhs.
+     */
+    template<typename rhs_T, typename ARG>
+    Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_type,traits_type::Columns,rhs_T::Columns>>>>
+    solve(const ExprBase<rhs_T,ARG>& rhs) const
+    {
+      static_assert(std::is_same_v<typename rhs_T::value_type,value_type>  &&
+                    rhs_T::Rows == M);
+
+      const Array<NoManipulator<RowMajorPolicy<rhs_T>>> b(rhs);
+      const value_type tol = threshold();
+
+      Array<NoManipulator<RowMajorPolicy<ArrayTraits<value_type,N,rhs_T::Columns>>>> result;
+      for(std::size_t j = 0; j < rhs_T::Columns; j++) {
+        value_type y[N];
+        for(std::size_t k = 0; k < N; k++) {
+          value_type sum{0};
+          for(std::size_t i = 0; i < M; i++) {
+            sum += _u[i*N + k]*b(i, j);
+          }
+          y[k] = _s[k] > tol
+              ? sum/_s[k]
+              : value_type{0};
+        }
+
+        for(std::size_t i = 0; i < N; i++) {
+          value_type sum{0};
+          for(std::size_t k = 0; k < N; k++) {
+            sum += _v[i*N + k]*y[k];
+          }
+          result(i, j) = sum;
+        }
+      }
+      return result;
+    }
+
+    vector_type singularValues() const
+    {
+      vector_type s;
+      for(std::size_t i = 0; i < N; i++) {
+        s(i, 0) = _s[i];
+      }
+      return s;
+    }
+
+    // Factors ///////////////////////////////////////////////////////////////
+
+    array_type matrixU() const
+    {
+      array_type U;
+      for(std::size_t i = 0; i < M; i++) {
+        for(std::size_t j = 0; j < N; j++) {
+          U(i, j) = _u[i*N + j];
+        }
+      }
+      return U;
+    }
+
+    v_type matrixV() const
+    {
+      v_type V;
+      for(std::size_t i = 0; i < N; i++) {
+        for(std::size_t j = 0; j < N; j++) {
+          V(i, j) = _v[i*N + j];
+        }
+      }
+      return V;
+    }
+
+  private:
+    static constexpr std::size_t M = traits_type::Rows;
+    static constexpr std::size_t N = traits_type::Columns;
+
+    void finish()
+    {
+      for(std::size_t j = 0; j < N; j++) {
+        value_type sum{0};
+        for(std::size_t i = 0; i < M; i++) {
+          sum += _u[i*N + j]*_u[i*N + j];
+        }
+        _s[j] = csSqrt(sum);
+
+        if( _s[j] > value_type{0} ) {
+          const value_type inv = value_type{1}/_s[j];
+          for(std::size_t i = 0; i < M; i++) {
+            _u[i*N + j] *= inv;
+          }
+        }
+      }
+
+      for(std::size_t j = 0; j < N; j++) {
+        std::size_t max = j;
+        for(std::size_t k = j + 1; k < N; k++) {
+          if( _s[k] > _s[max] ) {
+            max = k;
+          }
+        }
+        if( max == j ) {
+          continue;
+        }
+
+        std::swap(_s[j], _s[max]);
+        for(std::size_t i = 0; i < M; i++) {
+          std::swap(_u[i*N + j], _u[i*N + max]);
+        }
+        for(std::size_t i = 0; i < N; i++) {
+          std::swap(_v[i*N + j], _v[i*N + max]);
+        }
+      }
+    }
+
+    value_type threshold() const
+    {
+      return value_type(M)*std::numeric_limits<value_type>::epsilon()*_s[0];
+    }
+
+    value_type _u[M*N]{};
+    value_type _v[N*N]{};
+    value_type _s[N]{};
+  };
+
+  // Decomposition ///////////////////////////////////////////////////////////
+
+  template<typename traits_T, typename ARG>
+  inline SVD<traits_T> svd(const ExprBase<traits_T,ARG>& arg)
+  {
+    return SVD<traits_T>(arg);
+  }
+
+} // namespace cs
+
+#endif // SVD_H
@@ -0,0 +1,188 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef ARRAYBATCHIMPL_H
+#define ARRAYBATCHIMPL_H
+
+#include <cs/ArrayPolicy.h>
+#include <cs/ArrayTraits.h>
+#include <cs/ExprBase.h>
+#include <cs/SIMD.h>
+
+namespace cs {
+
+  namespace impl {
+
+    // Implementation - SIMD Packet //////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * A Packet<> holds one component of ElementCount consecutive elements of
+     * an ArrayBatch<>. It provides the arithmetic required by the scalar
+     * evaluation of the expression nodes, i.e. eval<i,j>().
+     */
+
+    template<typename T>
+    class Packet {
+    public:
+      using value_type = T;
+      using       simd = SIMD<value_type>;
+      using  simd_type = typename simd::simd_type;
+
+      static constexpr bool is_packet = true;
+
+      Packet(const value_type& value = value_type{0}) noexcept
+        : _x{simd::set(value)}
+      {
+      }
+
+      explicit Packet(const simd_type& x) noexcept
+        : _x{x}
+      {
+      }
+
+      ~Packet() noexcept = default;
+
+      inline simd_type data() const
+      {
+        return _x;
+      }
+
+      friend inline Packet operator+(const Packet& a, const Packet& b)
+      {
+        return Packet{simd::add(a._x, b._x)};
+      }
+
+      friend inline Packet operator-(const Packet& a, const Packet& b)
+      {
+        return Packet{simd::sub(a._x, b._x)};
+      }
+
+      friend inline Packet operator*(const Packet& a, const Packet& b)
+      {
+        return Packet{simd::mul(a._x, b._x)};
+      }
+
+      friend inline Packet operator/(const Packet& a, const Packet& b)
+      {
+        return Packet{simd::div(a._x, b._x)};
+      }
+
+      friend inline Packet operator-(const Packet& a)
+      {
+        return Packet{simd::sub(simd::zero(), a._x)};
+      }
+
+      friend inline Packet operator+(const Packet& a)
+      {
+        return a;
+      }
+
+      friend inline Packet csAbs(const Packet& x)
+      {
+        return Packet{simd::abs(x._x)};
+      }
+
+      friend inline Packet csCopySign(const Packet& x, const Packet& s)
+      {
+        return Packet{simd::copysign(x._x, s._x)};
+      }
+
+      friend inline Packet csSqrt(const Packet& x)
+      {
+        return Packet{simd::sqrt(x._x)};
+      }
+
+      /*
+       * NOTE:
+       * Selects the elements of x where a < b and those of y otherwise.
+       */
+      friend inline Packet csSelectLess(const Packet& a, const Packet& b,
+                                        const Packet& x, const Packet& y)
+      {
+        return Packet{simd::select(simd::cmplt(a._x, b._x), x._x, y._x)};
+      }
+
+    private:
+      simd_type _x;
+    };
+
+    // Implementation - Batch Packet /////////////////////////////////////////
+
+    template<typename batch_T>
+    class BatchPacket
+        : public ExprBase<typename batch_T::packet_traits,BatchPacket<batch_T>> {
+    public:
+      using typename ExprBase<typename batch_T::packet_traits,BatchPacket<batch_T>>::traits_type;
+      using typename ExprBase<typename batch_T::packet_traits,BatchPacket<batch_T>>::value_type;
+
+      static constexpr bool is_leaf = true;
+
+      BatchPacket(const batch_T& batch, const std::size_t k) noexcept
+        : _batch(batch)
+        , _k{k}
+      {
+      }
+
+      ~BatchPacket() noexcept = default;
+
+      template<std::size_t i, std::size_t j>
+      inline value_type eval() const
+      {
+        return _batch.packet(batch_T::policy_type::index(i, j), _k);
+      }
+
+    private:
+      const batch_T& _batch;
+      const std::size_t _k;
+    };
+
+    // Implementation - Batch Store //////////////////////////////////////////
+
+    template<typename batch_T, typename EXPR>
+    struct BatchStore {
+      using policy_type = typename batch_T::policy_type;
+
+      template<std::size_t l>
+      inline static void eval(batch_T& dest, const std::size_t k, const EXPR& src)
+      {
+        constexpr std::size_t i = policy_type::row(l);
+        constexpr std::size_t j = policy_type::column(l);
+
+        dest.setPacket(l, k, src.template eval<i,j>());
+      }
+    };
+
+  } // namespace impl
+
+} // namespace cs
+
+#endif // ARRAYBATCHIMPL_H
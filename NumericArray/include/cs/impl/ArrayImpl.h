@@ -32,12 +32,94 @@
 #ifndef ARRAYIMPL_H
 #define ARRAYIMPL_H
 
+#include <cs/impl/BinaryOperatorsImpl.h>
+#include <cs/ExprBase.h>
+#include <cs/Meta.h>
 #include <cs/SIMD.h>
 
 namespace cs {
 
   namespace impl {
 
+    // Implementation - Array Storage ////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * Backends without padding (cf. SIMD512) access the final, partial block
+     * of an array through a mask of TailCount elements.
+     */
+
+    template<typename traits_T>
+    struct ArrayStorage {
+      using traits_type = traits_T;
+      using  value_type = typename traits_type::value_type;
+      using        simd = SIMD<value_type>;
+      using   simd_type = typename simd::simd_type;
+
+      static constexpr std::size_t DataBlocks = simd::blocks(traits_type::Size);
+      static constexpr std::size_t   DataSize = simd::size(traits_type::Size);
+      static constexpr std::size_t  TailCount = DataSize%simd::ElementCount;
+
+      inline static simd_type load(const value_type *src, const std::size_t b)
+      {
+        if constexpr( TailCount > 0 ) {
+          if( b == DataBlocks - 1 ) {
+            return simd::load(src + b*simd::ElementCount, TailCount);
+          }
+        }
+        return simd::load(src + b*simd::ElementCount);
+      }
+
+      inline static void store(value_type *dest, const std::size_t b, const simd_type& x)
+      {
+        if constexpr( TailCount > 0 ) {
+          if( b == DataBlocks - 1 ) {
+            simd::store(dest + b*simd::ElementCount, x, TailCount);
+            return;
+          }
+        }
+        simd::store(dest + b*simd::ElementCount, x);
+      }
+    };
+
+    /*
+     * NOTE:
+     * Mapped storage is neither aligned nor padded; the final, partial block
+     * is accessed through a masked load/store of TailCount elements.
+     */
+
+    template<typename traits_T>
+    struct MapStorage {
+      using traits_type = traits_T;
+      using  value_type = typename traits_type::value_type;
+      using        simd = SIMD<value_type>;
+      using   simd_type = typename simd::simd_type;
+
+      static constexpr std::size_t DataBlocks = simd::blocks(traits_type::Size);
+      static constexpr std::size_t  TailCount = traits_type::Size%simd::ElementCount;
+
+      inline static simd_type load(const value_type *src, const std::size_t b)
+      {
+        if constexpr( TailCount > 0 ) {
+          if( b == DataBlocks - 1 ) {
+            return simd::load(src + b*simd::ElementCount, TailCount);
+          }
+        }
+        return simd::loadu(src + b*simd::ElementCount);
+      }
+
+      inline static void store(value_type *dest, const std::size_t b, const simd_type& x)
+      {
+        if constexpr( TailCount > 0 ) {
+          if( b == DataBlocks - 1 ) {
+            simd::store(dest + b*simd::ElementCount, x, TailCount);
+            return;
+          }
+        }
+        simd::storeu(dest + b*simd::ElementCount, x);
+      }
+    };
+
     // Implementation - Assign Array /////////////////////////////////////////
 
     template<typename policy_T, typename EXPR>
@@ -56,8 +138,52 @@ namespace cs {
       }
     };
 
-    template<typename policy_T, typename EXPR>
+    template<typename policy_T, typename EXPR,
+             typename storage_T = ArrayStorage<typename policy_T::traits_type>>
     struct BlockAssign {
+      using policy_type = policy_T;
+      using traits_type = typename policy_type::traits_type;
+      using  value_type = typename traits_type::value_type;
+      using     storage = storage_T;
+
+      template<std::size_t b>
+      inline static void eval(value_type *dest, const EXPR& src)
+      {
+        storage::store(dest, b, src.block(b));
+      }
+    };
+
+    /*
+     * NOTE:
+     * The source expression is evaluated blockwise in the transposed storage
+     * order of the destination; each block's elements are scattered into the
+     * destination afterwards.
+     */
+
+    template<typename policy_T, std::size_t b>
+    struct BlockScatter {
+      using     policy_type = policy_T;
+      using transposed_type = typename policy_type::transposed_type;
+      using     traits_type = typename policy_type::traits_type;
+      using      value_type = typename traits_type::value_type;
+      using            simd = SIMD<value_type>;
+
+      template<std::size_t e>
+      inline static void eval(value_type *dest, const value_type *src)
+      {
+        constexpr std::size_t l = b*simd::ElementCount + e;
+
+        if constexpr( l < traits_type::Size ) {
+          constexpr std::size_t i = transposed_type::row(l);
+          constexpr std::size_t j = transposed_type::column(l);
+
+          dest[policy_type::index(i, j)] = src[e];
+        }
+      }
+    };
+
+    template<typename policy_T, typename EXPR>
+    struct BlockTransposeAssign {
       using policy_type = policy_T;
       using traits_type = typename policy_type::traits_type;
       using  value_type = typename traits_type::value_type;
@@ -66,9 +192,11 @@ namespace cs {
       template<std::size_t b>
       inline static void eval(value_type *dest, const EXPR& src)
       {
-        constexpr std::size_t l = b*simd::ElementCount;
+        using SCATTER = BlockScatter<policy_type,b>;
 
-        simd::store(dest + l, src.block(b));
+        alignas(simd::Alignment) value_type temp[simd::ElementCount];
+        simd::store(temp, src.block(b));
+        meta::for_each<simd::ElementCount,SCATTER>(dest, temp);
       }
     };
 
@@ -90,14 +218,12 @@ namespace cs {
     struct BlockCopy {
       using traits_type = traits_T;
       using  value_type = typename traits_type::value_type;
-      using        simd = SIMD<value_type>;
+      using     storage = ArrayStorage<traits_type>;
 
       template<std::size_t b>
       inline static void eval(value_type *dest, const value_type *src)
       {
-        constexpr std::size_t l = b*simd::ElementCount;
-
-        simd::store(dest + l, simd::load(src + l));
+        storage::store(dest, b, storage::load(src, b));
       }
     };
 
@@ -129,19 +255,57 @@ namespace cs {
       }
     };
 
-    template<typename traits_T>
+    template<typename traits_T, typename storage_T = ArrayStorage<traits_T>>
     struct BlockSet {
       using traits_type = traits_T;
       using  value_type = typename traits_type::value_type;
       using        simd = SIMD<value_type>;
+      using     storage = storage_T;
 
       template<std::size_t b>
       inline static void eval(value_type *dest, const value_type value)
       {
-        constexpr std::size_t l = b*simd::ElementCount;
+        storage::store(dest, b, simd::set(value));
+      }
+    };
+
+    // Implementation - No Alias Assignment //////////////////////////////////
 
-        simd::store(dest + l, simd::set(value));
+    template<typename array_T>
+    class NoAlias {
+    public:
+      using  array_type = array_T;
+      using traits_type = typename array_type::traits_type;
+
+      NoAlias(array_type& array) noexcept
+        : _array(array)
+      {
+      }
+
+      ~NoAlias() noexcept = default;
+
+      template<typename EXPR>
+      inline array_type& operator=(const ExprBase<traits_type,EXPR>& expr)
+      {
+        return _array.assign(expr);
       }
+
+      template<typename EXPR>
+      inline array_type& operator+=(const ExprBase<traits_type,EXPR>& expr)
+      {
+        return _array.assign(BinAdd<traits_type,array_type,EXPR>(_array, expr.as_derived()));
+      }
+
+      template<typename EXPR>
+      inline array_type& operator-=(const ExprBase<traits_type,EXPR>& expr)
+      {
+        return _array.assign(BinSub<traits_type,array_type,EXPR>(_array, expr.as_derived()));
+      }
+
+    private:
+      NoAlias() noexcept = delete;
+
+      array_type& _array;
     };
 
   } // namespace impl
@@ -32,6 +32,7 @@
 #ifndef BINARYOPERATORSIMPL_H
 #define BINARYOPERATORSIMPL_H
 
+#include <cs/ArrayPolicy.h>
 #include <cs/ExprBase.h>
 #include <cs/Meta.h>
 #include <cs/SIMD.h>
@@ -49,6 +50,8 @@ namespace cs {
       using typename ExprBase<traits_T,BinAdd<traits_T,LHS,RHS>>::traits_type;
       using typename ExprBase<traits_T,BinAdd<traits_T,LHS,RHS>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<LHS>  ||  if_reordering_v<RHS>;
+
       BinAdd(const LHS& lhs, const RHS& rhs) noexcept
         : _lhs{lhs}
         , _rhs{rhs}
@@ -57,6 +60,11 @@ namespace cs {
 
       ~BinAdd() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return common_size(_lhs, _rhs);
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -69,14 +77,23 @@ namespace cs {
         return check_simd<LHS,simd_policy_T,check_policy>()  &&  check_simd<RHS,simd_policy_T,check_policy>();
       }
 
+      /*
+       * NOTE:
+       * A product on either side is fused with the addition; cf. have_fma.
+       */
       inline simd_type<value_type> block(const std::size_t b) const
       {
+        if constexpr( if_fma_v<LHS> ) {
+          return _lhs.fmadd(b, _rhs.block(b));
+        } else if constexpr( if_fma_v<RHS> ) {
+          return _rhs.fmadd(b, _lhs.block(b));
+        }
         return SIMD<value_type>::add(_lhs.block(b), _rhs.block(b));
       }
 
     private:
-      const LHS& _lhs;
-      const RHS& _rhs;
+      operand_t<LHS> _lhs;
+      operand_t<RHS> _rhs;
     };
 
     // Implementation - Scalar Division //////////////////////////////////////
@@ -88,6 +105,8 @@ namespace cs {
       using typename ExprBase<traits_T,BinSDiv<traits_T,OP>>::traits_type;
       using typename ExprBase<traits_T,BinSDiv<traits_T,OP>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<OP>;
+
       BinSDiv(const OP& op, const value_type scalar) noexcept
         : _op(op)
         , _scalar{scalar}
@@ -96,6 +115,11 @@ namespace cs {
 
       ~BinSDiv() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return _op.size();
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -115,7 +139,7 @@ namespace cs {
       }
 
     private:
-      const OP& _op;
+      operand_t<OP> _op;
       value_type _scalar;
     };
 
@@ -137,6 +161,41 @@ namespace cs {
       }
     };
 
+    template<typename value_T, std::size_t STRIDE, typename ARG>
+    struct BinMulBlock {
+      using value_type = value_T;
+      using       simd = SIMD<value_type>;
+      using  simd_type = typename simd::simd_type;
+
+      template<std::size_t k>
+      inline static void eval(simd_type& y, const value_type *x, const ARG& arg,
+                              const std::size_t b0)
+      {
+        y = simd::fmadd(simd::set(x[k]), arg.block(k*STRIDE + b0), y);
+      }
+    };
+
+    template<typename value_T, typename ARG>
+    struct BinMulLoad {
+      using value_type = value_T;
+      using       simd = SIMD<value_type>;
+
+      template<std::size_t k>
+      inline static void eval(value_type *x, const ARG& arg, const std::size_t b0)
+      {
+        simd::store(x + k*simd::ElementCount, arg.block(b0 + k));
+      }
+    };
+
+    /*
+     * NOTE:
+     * The SIMD path requires operands sharing the result's policy whose rows
+     * (RowMajorPolicy) or columns (ColumnMajorPolicy) consist of whole blocks.
+     * A block of a row-major result then is a row segment accumulated from
+     * broadcast elements of the left hand side's row times the right hand side's
+     * row segments; column-major results are accumulated vice versa.
+     */
+
     template<typename traits_T, std::size_t INNER, typename LHS, typename RHS>
     class BinMul
         : public ExprBase<traits_T,BinMul<traits_T,INNER,LHS,RHS>> {
@@ -144,6 +203,8 @@ namespace cs {
       using typename ExprBase<traits_T,BinMul<traits_T,INNER,LHS,RHS>>::traits_type;
       using typename ExprBase<traits_T,BinMul<traits_T,INNER,LHS,RHS>>::value_type;
 
+      static constexpr bool is_reordering = true;
+
       BinMul(const LHS& lhs, const RHS& rhs) noexcept
         : _lhs(lhs)
         , _rhs(rhs)
@@ -159,9 +220,67 @@ namespace cs {
         return meta::accumulate<value_type,INNER,PROD>(_lhs, _rhs);
       }
 
+      template<typename simd_policy_T, bool check_policy>
+      static constexpr bool is_simd()
+      {
+        using simd = SIMD<value_type>;
+        if constexpr( !check_policy  ||  INNER%simd::ElementCount != 0 ) {
+          return false;
+        } else if constexpr( RowMajorPolicy<traits_type>::template is_same_v<simd_policy_T> ) {
+          return traits_type::Columns%simd::ElementCount == 0  &&
+              check_simd<LHS,simd_policy_T,check_policy>()  &&  check_simd<RHS,simd_policy_T,check_policy>();
+        } else if constexpr( ColumnMajorPolicy<traits_type>::template is_same_v<simd_policy_T> ) {
+          return traits_type::Rows%simd::ElementCount == 0  &&
+              check_simd<LHS,simd_policy_T,check_policy>()  &&  check_simd<RHS,simd_policy_T,check_policy>();
+        }
+        return false;
+      }
+
+      static constexpr bool have_fma = true;
+
+      inline simd_type<value_type> block(const std::size_t b) const
+      {
+        return fmadd(b, SIMD<value_type>::zero());
+      }
+
+      inline simd_type<value_type> fmadd(const std::size_t b, const simd_type<value_type>& c) const
+      {
+        using simd = SIMD<value_type>;
+
+        constexpr std::size_t InnerBlocks = INNER/simd::ElementCount;
+
+        alignas(simd::Alignment) value_type x[INNER];
+        simd_type<value_type> y = c;
+
+        if constexpr( is_row_major() ) {
+          constexpr std::size_t RowBlocks = traits_type::Columns/simd::ElementCount;
+
+          using LOAD = BinMulLoad<value_type,LHS>;
+          using  ACC = BinMulBlock<value_type,RowBlocks,RHS>;
+
+          meta::for_each<InnerBlocks,LOAD>(x, _lhs, (b/RowBlocks)*InnerBlocks);
+          meta::for_each<INNER,ACC>(y, x, _rhs, b%RowBlocks);
+        } else {
+          constexpr std::size_t ColumnBlocks = traits_type::Rows/simd::ElementCount;
+
+          using LOAD = BinMulLoad<value_type,RHS>;
+          using  ACC = BinMulBlock<value_type,ColumnBlocks,LHS>;
+
+          meta::for_each<InnerBlocks,LOAD>(x, _rhs, (b/ColumnBlocks)*InnerBlocks);
+          meta::for_each<INNER,ACC>(y, x, _lhs, b%ColumnBlocks);
+        }
+
+        return y;
+      }
+
     private:
-      const LHS& _lhs;
-      const RHS& _rhs;
+      static constexpr bool is_row_major()
+      {
+        return check_simd<LHS,RowMajorPolicy<traits_type>>()  &&  check_simd<RHS,RowMajorPolicy<traits_type>>();
+      }
+
+      operand_t<LHS> _lhs;
+      operand_t<RHS> _rhs;
     };
 
     // Implementation - Scalar Multiplication ////////////////////////////////
@@ -173,6 +292,8 @@ namespace cs {
       using typename ExprBase<traits_T,BinSMul<traits_T,OP>>::traits_type;
       using typename ExprBase<traits_T,BinSMul<traits_T,OP>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<OP>;
+
       BinSMul(const OP& op, const value_type scalar) noexcept
         : _op(op)
         , _scalar{scalar}
@@ -181,6 +302,11 @@ namespace cs {
 
       ~BinSMul() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return _op.size();
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -193,14 +319,22 @@ namespace cs {
         return check_simd<OP,simd_policy_T,check_policy>();
       }
 
+      static constexpr bool have_fma = true;
+
       inline simd_type<value_type> block(const std::size_t b) const
       {
         using simd = SIMD<value_type>;
         return simd::mul(_op.block(b), simd::set(_scalar));
       }
 
+      inline simd_type<value_type> fmadd(const std::size_t b, const simd_type<value_type>& c) const
+      {
+        using simd = SIMD<value_type>;
+        return simd::fmadd(_op.block(b), simd::set(_scalar), c);
+      }
+
     private:
-      const OP& _op;
+      operand_t<OP> _op;
       const value_type _scalar;
     };
 
@@ -213,6 +347,8 @@ namespace cs {
       using typename ExprBase<traits_T,BinProduct<traits_T,LHS,RHS>>::traits_type;
       using typename ExprBase<traits_T,BinProduct<traits_T,LHS,RHS>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<LHS>  ||  if_reordering_v<RHS>;
+
       BinProduct(const LHS& lhs, const RHS& rhs) noexcept
         : _lhs(lhs)
         , _rhs(rhs)
@@ -221,6 +357,11 @@ namespace cs {
 
       ~BinProduct() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return common_size(_lhs, _rhs);
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -233,14 +374,21 @@ namespace cs {
         return check_simd<LHS,simd_policy_T,check_policy>()  &&  check_simd<RHS,simd_policy_T,check_policy>();
       }
 
+      static constexpr bool have_fma = true;
+
       inline simd_type<value_type> block(const std::size_t b) const
       {
         return SIMD<value_type>::mul(_lhs.block(b), _rhs.block(b));
       }
 
+      inline simd_type<value_type> fmadd(const std::size_t b, const simd_type<value_type>& c) const
+      {
+        return SIMD<value_type>::fmadd(_lhs.block(b), _rhs.block(b), c);
+      }
+
     private:
-      const LHS& _lhs;
-      const RHS& _rhs;
+      operand_t<LHS> _lhs;
+      operand_t<RHS> _rhs;
     };
 
     // Implementation - Subtraction //////////////////////////////////////////
@@ -252,6 +400,8 @@ namespace cs {
       using typename ExprBase<traits_T,BinSub<traits_T,LHS,RHS>>::traits_type;
       using typename ExprBase<traits_T,BinSub<traits_T,LHS,RHS>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<LHS>  ||  if_reordering_v<RHS>;
+
       BinSub(const LHS& lhs, const RHS& rhs) noexcept
         : _lhs(lhs)
         , _rhs(rhs)
@@ -260,6 +410,11 @@ namespace cs {
 
       ~BinSub() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return common_size(_lhs, _rhs);
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -278,8 +433,8 @@ namespace cs {
       }
 
     private:
-      const LHS& _lhs;
-      const RHS& _rhs;
+      operand_t<LHS> _lhs;
+      operand_t<RHS> _rhs;
     };
 
   } // namespace impl
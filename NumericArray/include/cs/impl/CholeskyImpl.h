@@ -0,0 +1,331 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef CHOLESKYIMPL_H
+#define CHOLESKYIMPL_H
+
+#include <cs/Math.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  namespace impl {
+
+    /*
+     * NOTE:
+     * The kernels below operate on a row-major NxN array holding the lower
+     * triangle of a symmetric matrix, which is overwritten with its factors.
+     * They only require arithmetic operators and csSqrt(); hence they
+     * evaluate Packet<>s (cf. ArrayBatch<>) as well as scalars.
+     */
+
+    // Implementation - Symmetric Load ///////////////////////////////////////
+
+    template<std::size_t N, typename ARG>
+    struct LowerLoad {
+      template<std::size_t l, typename value_T>
+      inline static void eval(value_T *L, const ARG& arg)
+      {
+        constexpr std::size_t i = l/N;
+        constexpr std::size_t j = l%N;
+
+        if constexpr( j <= i ) {
+          L[l] = arg.template eval<i,j>();
+        }
+      }
+    };
+
+    // Implementation - Cholesky Decomposition ///////////////////////////////
+
+    template<typename value_T, std::size_t N, std::size_t i, std::size_t j>
+    struct CholeskyDot {
+      inline static value_T accumulate(const value_T& a, const value_T& b)
+      {
+        return a + b;
+      }
+
+      template<std::size_t k>
+      inline static value_T eval(const value_T *L)
+      {
+        return L[i*N + k]*L[j*N + k];
+      }
+    };
+
+    template<typename value_T, std::size_t N, std::size_t j>
+    struct CholeskyRow {
+      template<std::size_t r>
+      inline static void eval(value_T *L, const value_T& inv)
+      {
+        constexpr std::size_t i = j + 1 + r;
+
+        value_T x = L[i*N + j];
+        if constexpr( j > 0 ) {
+          x = x - meta::accumulate<value_T,j,CholeskyDot<value_T,N,i,j>>(L);
+        }
+        L[i*N + j] = x*inv;
+      }
+    };
+
+    template<typename value_T, std::size_t N>
+    struct CholeskyColumn {
+      template<std::size_t j>
+      inline static void eval(value_T *L)
+      {
+        value_T x = L[j*N + j];
+        if constexpr( j > 0 ) {
+          x = x - meta::accumulate<value_T,j,CholeskyDot<value_T,N,j,j>>(L);
+        }
+        const value_T ljj = csSqrt(x);
+        L[j*N + j] = ljj;
+
+        if constexpr( j + 1 < N ) {
+          const value_T inv = value_T{1}/ljj;
+          meta::for_each<N-1-j,CholeskyRow<value_T,N,j>>(L, inv);
+        }
+      }
+    };
+
+    // Implementation - LDLT Decomposition ///////////////////////////////////
+
+    template<typename value_T, std::size_t N, std::size_t i, std::size_t j>
+    struct LDLTDot {
+      inline static value_T accumulate(const value_T& a, const value_T& b)
+      {
+        return a + b;
+      }
+
+      template<std::size_t k>
+      inline static value_T eval(const value_T *L)
+      {
+        return L[i*N + k]*L[j*N + k]*L[k*N + k];
+      }
+    };
+
+    template<typename value_T, std::size_t N, std::size_t j>
+    struct LDLTRow {
+      template<std::size_t r>
+      inline static void eval(value_T *L, const value_T& inv)
+      {
+        constexpr std::size_t i = j + 1 + r;
+
+        value_T x = L[i*N + j];
+        if constexpr( j > 0 ) {
+          x = x - meta::accumulate<value_T,j,LDLTDot<value_T,N,i,j>>(L);
+        }
+        L[i*N + j] = x*inv;
+      }
+    };
+
+    template<typename value_T, std::size_t N>
+    struct LDLTColumn {
+      template<std::size_t j>
+      inline static void eval(value_T *L)
+      {
+        value_T d = L[j*N + j];
+        if constexpr( j > 0 ) {
+          d = d - meta::accumulate<value_T,j,LDLTDot<value_T,N,j,j>>(L);
+        }
+        L[j*N + j] = d;
+
+        if constexpr( j + 1 < N ) {
+          const value_T inv = value_T{1}/d;
+          meta::for_each<N-1-j,LDLTRow<value_T,N,j>>(L, inv);
+        }
+      }
+    };
+
+    // Implementation - Triangular Substitution //////////////////////////////
+
+    template<typename value_T, std::size_t N, std::size_t i>
+    struct ForwardDot {
+      inline static value_T accumulate(const value_T& a, const value_T& b)
+      {
+        return a + b;
+      }
+
+      template<std::size_t k>
+      inline static value_T eval(const value_T *L, const value_T *x)
+      {
+        return L[i*N + k]*x[k];
+      }
+    };
+
+    template<typename value_T, std::size_t N, std::size_t i>
+    struct BackwardDot {
+      inline static value_T accumulate(const value_T& a, const value_T& b)
+      {
+        return a + b;
+      }
+
+      template<std::size_t r>
+      inline static value_T eval(const value_T *L, const value_T *x)
+      {
+        constexpr std::size_t k = i + 1 + r;
+
+        return L[k*N + i]*x[k];
+      }
+    };
+
+    /*
+     * NOTE:
+     * Solves L*y = x in place; a unit diagonal of L is implied if requested.
+     */
+    template<typename value_T, std::size_t N, bool unit>
+    struct LowerForward {
+      template<std::size_t i>
+      inline static void eval(const value_T *L, value_T *x)
+      {
+        if constexpr( i > 0 ) {
+          x[i] = x[i] - meta::accumulate<value_T,i,ForwardDot<value_T,N,i>>(L, x);
+        }
+        if constexpr( !unit ) {
+          x[i] = x[i]/L[i*N + i];
+        }
+      }
+    };
+
+    /*
+     * NOTE:
+     * Solves transpose(L)*y = x in place; a unit diagonal of L is implied if
+     * requested.
+     */
+    template<typename value_T, std::size_t N, bool unit>
+    struct LowerBackward {
+      template<std::size_t r>
+      inline static void eval(const value_T *L, value_T *x)
+      {
+        constexpr std::size_t i = N - 1 - r;
+
+        if constexpr( r > 0 ) {
+          x[i] = x[i] - meta::accumulate<value_T,r,BackwardDot<value_T,N,i>>(L, x);
+        }
+        if constexpr( !unit ) {
+          x[i] = x[i]/L[i*N + i];
+        }
+      }
+    };
+
+    template<typename value_T, std::size_t N>
+    struct DiagonalDivide {
+      template<std::size_t i>
+      inline static void eval(const value_T *L, value_T *x)
+      {
+        x[i] = x[i]/L[i*N + i];
+      }
+    };
+
+    template<typename value_T, std::size_t N>
+    struct DiagonalProduct {
+      inline static value_T accumulate(const value_T& a, const value_T& b)
+      {
+        return a*b;
+      }
+
+      template<std::size_t i>
+      inline static value_T eval(const value_T *L)
+      {
+        return L[i*N + i];
+      }
+    };
+
+    // Implementation - Rank-1 Update ////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * Updates the factors of A to the factors of A + sigma*x*transpose(x);
+     * x is overwritten.
+     */
+
+    template<typename value_T, std::size_t N, std::size_t k>
+    struct CholeskyUpdateRow {
+      template<std::size_t r>
+      inline static void eval(value_T *L, value_T *x,
+                              const value_T& c, const value_T& s, const value_T& sigma)
+      {
+        constexpr std::size_t i = k + 1 + r;
+
+        L[i*N + k] = (L[i*N + k] + sigma*s*x[i])/c;
+        x[i]       = c*x[i] - s*L[i*N + k];
+      }
+    };
+
+    template<typename value_T, std::size_t N>
+    struct CholeskyUpdate {
+      template<std::size_t k>
+      inline static void eval(value_T *L, value_T *x, const value_T& sigma)
+      {
+        const value_T lkk = L[k*N + k];
+        const value_T   r = csSqrt(lkk*lkk + sigma*x[k]*x[k]);
+        const value_T   c = r/lkk;
+        const value_T   s = x[k]/lkk;
+        L[k*N + k] = r;
+
+        if constexpr( k + 1 < N ) {
+          meta::for_each<N-1-k,CholeskyUpdateRow<value_T,N,k>>(L, x, c, s, sigma);
+        }
+      }
+    };
+
+    template<typename value_T, std::size_t N, std::size_t j>
+    struct LDLTUpdateRow {
+      template<std::size_t r>
+      inline static void eval(value_T *L, value_T *x, const value_T& p, const value_T& beta)
+      {
+        constexpr std::size_t i = j + 1 + r;
+
+        x[i]       = x[i] - p*L[i*N + j];
+        L[i*N + j] = L[i*N + j] + beta*x[i];
+      }
+    };
+
+    template<typename value_T, std::size_t N>
+    struct LDLTUpdate {
+      template<std::size_t j>
+      inline static void eval(value_T *L, value_T *x, value_T& alpha)
+      {
+        const value_T    p = x[j];
+        const value_T   dj = L[j*N + j];
+        const value_T dnew = dj + alpha*p*p;
+        const value_T beta = p*alpha/dnew;
+        alpha = alpha*dj/dnew;
+        L[j*N + j] = dnew;
+
+        if constexpr( j + 1 < N ) {
+          meta::for_each<N-1-j,LDLTUpdateRow<value_T,N,j>>(L, x, p, beta);
+        }
+      }
+    };
+
+  } // namespace impl
+
+} // namespace cs
+
+#endif // CHOLESKYIMPL_H
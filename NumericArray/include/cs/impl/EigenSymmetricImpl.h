@@ -0,0 +1,295 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef EIGENSYMMETRICIMPL_H
+#define EIGENSYMMETRICIMPL_H
+
+#include <limits>
+
+#include <cs/Math.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  namespace impl {
+
+    /*
+     * NOTE:
+     * The kernels below operate on row-major 3x3 arrays; a holds the
+     * symmetric input, v accumulates the eigenvectors in its columns and w
+     * holds the eigenvalues. The Jacobi kernels only require arithmetic
+     * operators and the cs*() functions used; hence they evaluate Packet<>s
+     * (cf. ArrayBatch<>) as well as scalars.
+     */
+
+    // Implementation - Symmetric Load ///////////////////////////////////////
+
+    template<typename ARG>
+    struct SymmetricLoad3x3 {
+      template<std::size_t l, typename value_T>
+      inline static void eval(value_T *a, const ARG& arg)
+      {
+        constexpr std::size_t i = l/3;
+        constexpr std::size_t j = l%3;
+
+        if constexpr( j <= i ) {
+          a[i*3 + j] = a[j*3 + i] = arg.template eval<i,j>();
+        }
+      }
+    };
+
+    // Implementation - Jacobi Rotation //////////////////////////////////////
+
+    /*
+     * NOTE:
+     * Rotation k of a cyclic sweep annihilates the element (p,q), with
+     * (p,q) = (0,1), (0,2), (1,2). The rotation angle is restricted to
+     * [-pi/4,pi/4] without branching on the sign of a(q,q) - a(p,p); tiny
+     * avoids a division by zero for an already diagonal (p,q) block.
+     */
+
+    template<typename value_T, typename real_T>
+    struct JacobiRotate3x3 {
+      template<std::size_t k>
+      inline static void eval(value_T *a, value_T *v)
+      {
+        constexpr std::size_t p = k == 2 ? 1 : 0;
+        constexpr std::size_t q = k == 0 ? 1 : 2;
+        constexpr std::size_t r = 3 - p - q;
+
+        const value_T tiny{std::numeric_limits<real_T>::min()};
+        const value_T  one{1};
+        const value_T  two{2};
+
+        const value_T apq = a[p*3 + q];
+        const value_T   d = a[q*3 + q] - a[p*3 + p];
+        const value_T  rr = csSqrt(d*d + two*two*apq*apq);
+        const value_T   t = two*apq/csCopySign(csAbs(d) + rr + tiny, d);
+        const value_T   c = one/csSqrt(one + t*t);
+        const value_T   s = t*c;
+
+        a[p*3 + p] = a[p*3 + p] - t*apq;
+        a[q*3 + q] = a[q*3 + q] + t*apq;
+        a[p*3 + q] = a[q*3 + p] = value_T{0};
+
+        const value_T arp = a[r*3 + p];
+        const value_T arq = a[r*3 + q];
+        a[r*3 + p] = a[p*3 + r] = c*arp - s*arq;
+        a[r*3 + q] = a[q*3 + r] = s*arp + c*arq;
+
+        for(std::size_t i = 0; i < 3; i++) {
+          const value_T vip = v[i*3 + p];
+          const value_T viq = v[i*3 + q];
+          v[i*3 + p] = c*vip - s*viq;
+          v[i*3 + q] = s*vip + c*viq;
+        }
+      }
+    };
+
+    // Implementation - Eigenvalue Sort //////////////////////////////////////
+
+    /*
+     * NOTE:
+     * A sorting network of three compare-exchange steps, (0,1), (1,2) and
+     * (0,1), orders the eigenvalues ascending and permutes the eigenvectors
+     * accordingly; cf. EigenJacobi3x3<>::finish() for their handedness.
+     */
+
+    template<typename value_T>
+    struct EigenSort3x3 {
+      template<std::size_t k>
+      inline static void eval(value_T *w, value_T *v)
+      {
+        constexpr std::size_t i = k == 1 ? 1 : 0;
+        constexpr std::size_t j = i + 1;
+
+        const value_T wi = w[i];
+        const value_T wj = w[j];
+        w[i] = csSelectLess(wj, wi, wj, wi);
+        w[j] = csSelectLess(wj, wi, wi, wj);
+
+        for(std::size_t r = 0; r < 3; r++) {
+          const value_T vri = v[r*3 + i];
+          const value_T vrj = v[r*3 + j];
+          v[r*3 + i] = csSelectLess(wj, wi, vrj, vri);
+          v[r*3 + j] = csSelectLess(wj, wi, vri, vrj);
+        }
+      }
+    };
+
+    // Implementation - Jacobi Eigensolver ///////////////////////////////////
+
+    template<typename value_T, typename real_T>
+    struct EigenJacobi3x3 {
+      inline static void identity(value_T *v)
+      {
+        for(std::size_t l = 0; l < 9; l++) {
+          v[l] = value_T{l%4 == 0 ? real_T{1} : real_T{0}};
+        }
+      }
+
+      inline static void sweep(value_T *a, value_T *v)
+      {
+        using ROTATE = JacobiRotate3x3<value_T,real_T>;
+        meta::for_each<3,ROTATE>(a, v);
+      }
+
+      inline static void finish(const value_T *a, value_T *w, value_T *v)
+      {
+        w[0] = a[0];
+        w[1] = a[4];
+        w[2] = a[8];
+
+        using SORT = EigenSort3x3<value_T>;
+        meta::for_each<3,SORT>(w, v);
+
+        // NOTE: Restore the handedness, which each swap of two columns flips.
+        for(std::size_t i = 0; i < 3; i++) {
+          const std::size_t j = (i + 1)%3;
+          const std::size_t k = (i + 2)%3;
+          v[i*3 + 1] = v[j*3 + 2]*v[k*3 + 0] - v[k*3 + 2]*v[j*3 + 0];
+        }
+      }
+    };
+
+    // Implementation - Analytic Eigensolver /////////////////////////////////
+
+    /*
+     * NOTE:
+     * The eigenvalues are the roots of the characteristic polynomial, which
+     * are computed using trigonometric functions. The eigenvectors of the
+     * largest and smallest eigenvalue are the largest cross product of two
+     * rows of A - lambda*I; the remaining eigenvector is their cross
+     * product. run() fails if a cross product becomes too small to be
+     * accurate, i.e. for (nearly) degenerate eigenvalues.
+     */
+
+    template<typename real_T>
+    struct EigenAnalytic3x3 {
+      using value_type = real_T;
+
+      inline static bool run(const value_type *a, value_type *w, value_type *v)
+      {
+        const value_type p1 = a[1]*a[1] + a[2]*a[2] + a[5]*a[5];
+        if( p1 == value_type{0} ) {
+          EigenJacobi3x3<value_type,value_type>::identity(v);
+          EigenJacobi3x3<value_type,value_type>::finish(a, w, v);
+          return true;
+        }
+
+        const value_type   q = (a[0] + a[4] + a[8])/value_type{3};
+        const value_type b00 = a[0] - q;
+        const value_type b11 = a[4] - q;
+        const value_type b22 = a[8] - q;
+        const value_type   p = csSqrt((b00*b00 + b11*b11 + b22*b22 + value_type{2}*p1)/value_type{6});
+
+        const value_type det =
+            b00*(b11*b22 - a[5]*a[5]) -
+            a[1]*(a[1]*b22 - a[5]*a[2]) +
+            a[2]*(a[1]*a[5] - b11*a[2]);
+        const value_type   r = csClamp(det/(value_type{2}*p*p*p), value_type{-1}, value_type{1});
+        const value_type phi = csACos(r)/value_type{3};
+        const value_type cphi = csCos(phi);
+        const value_type sphi = csSin(phi);
+
+        // NOTE: cos(phi + 2pi/3) = -(cos(phi) + sqrt(3)*sin(phi))/2
+        const value_type lmax = q + value_type{2}*p*cphi;
+        const value_type lmin = q - p*(cphi + csSqrt(value_type{3})*sphi);
+        const value_type lmid = value_type{3}*q - lmax - lmin;
+
+        const value_type scale = csMax(csAbs(lmax), csAbs(lmin));
+        const value_type limit = value_type{256}*std::numeric_limits<value_type>::epsilon()*
+            scale*scale*scale*scale;
+
+        value_type vmax[3], vmin[3];
+        if( !vector(a, lmax, vmax, limit)  ||  !vector(a, lmin, vmin, limit) ) {
+          return false;
+        }
+
+        w[0] = lmin;
+        w[1] = lmid;
+        w[2] = lmax;
+        for(std::size_t i = 0; i < 3; i++) {
+          v[i*3 + 0] = vmin[i];
+          v[i*3 + 1] = vmax[(i + 1)%3]*vmin[(i + 2)%3] - vmax[(i + 2)%3]*vmin[(i + 1)%3];
+          v[i*3 + 2] = vmax[i];
+        }
+
+        return true;
+      }
+
+    private:
+      inline static void cross(const value_type *x, const value_type *y, value_type *z)
+      {
+        z[0] = x[1]*y[2] - x[2]*y[1];
+        z[1] = x[2]*y[0] - x[0]*y[2];
+        z[2] = x[0]*y[1] - x[1]*y[0];
+      }
+
+      inline static value_type norm2(const value_type *x)
+      {
+        return x[0]*x[0] + x[1]*x[1] + x[2]*x[2];
+      }
+
+      inline static bool vector(const value_type *a, const value_type lambda,
+                                value_type *x, const value_type limit)
+      {
+        const value_type r0[3] = { a[0] - lambda, a[1], a[2] };
+        const value_type r1[3] = { a[3], a[4] - lambda, a[5] };
+        const value_type r2[3] = { a[6], a[7], a[8] - lambda };
+
+        value_type c[3][3];
+        cross(r0, r1, c[0]);
+        cross(r0, r2, c[1]);
+        cross(r1, r2, c[2]);
+
+        const value_type n[3] = { norm2(c[0]), norm2(c[1]), norm2(c[2]) };
+        const std::size_t max = n[0] >= n[1]
+            ? (n[0] >= n[2] ? 0 : 2)
+            : (n[1] >= n[2] ? 1 : 2);
+        if( !(n[max] > limit) ) {
+          return false;
+        }
+
+        const value_type s = value_type{1}/csSqrt(n[max]);
+        x[0] = c[max][0]*s;
+        x[1] = c[max][1]*s;
+        x[2] = c[max][2]*s;
+
+        return true;
+      }
+    };
+
+  } // namespace impl
+
+} // namespace cs
+
+#endif // EIGENSYMMETRICIMPL_H
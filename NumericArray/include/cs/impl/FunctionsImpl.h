@@ -33,7 +33,10 @@
 #define FUNCTIONSIMPL_H
 
 #include <cs/impl/IndexingImpl.h>
+#include <cs/Array.h>
+#include <cs/ArrayPolicy.h>
 #include <cs/ExprBase.h>
+#include <cs/Manipulator.h>
 #include <cs/Math.h>
 #include <cs/Meta.h>
 #include <cs/SIMD.h>
@@ -50,6 +53,8 @@ namespace cs {
       using typename ExprBase<traits_T,Cast<traits_T,ARG>>::traits_type;
       using typename ExprBase<traits_T,Cast<traits_T,ARG>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<ARG>;
+
       static_assert(if_identical_v<traits_type,typename ARG::traits_type>);
 
       Cast(const ARG& arg) noexcept
@@ -59,6 +64,11 @@ namespace cs {
 
       ~Cast() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return _arg.size();
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -77,7 +87,7 @@ namespace cs {
       }
 
     private:
-      const ARG& _arg;
+      operand_t<ARG> _arg;
     };
 
     // Implementation - Clamp ////////////////////////////////////////////////
@@ -88,6 +98,8 @@ namespace cs {
       using typename ExprBase<traits_T,SClamp<traits_T,ARG>>::traits_type;
       using typename ExprBase<traits_T,SClamp<traits_T,ARG>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<ARG>;
+
       SClamp(const ARG& arg, const value_type lo, const value_type hi) noexcept
         : _arg(arg)
         , _lo{lo}
@@ -97,6 +109,11 @@ namespace cs {
 
       ~SClamp() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return _arg.size();
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -116,10 +133,50 @@ namespace cs {
       }
 
     private:
-      const ARG& _arg;
+      operand_t<ARG> _arg;
       const value_type _lo{}, _hi{};
     };
 
+    // Implementation - 2x2 Adjugate Matrix //////////////////////////////////
+
+    template<typename traits_T, typename ARG>
+    class Adjugate2x2 : public ExprBase<traits_T,Adjugate2x2<traits_T,ARG>> {
+    public:
+      using typename ExprBase<traits_T,Adjugate2x2<traits_T,ARG>>::traits_type;
+      using typename ExprBase<traits_T,Adjugate2x2<traits_T,ARG>>::value_type;
+
+      static constexpr bool is_reordering = true;
+
+      static_assert(if_dimensions_v<traits_type,2,2>);
+
+      Adjugate2x2(const ARG& arg) noexcept
+        : _arg(arg)
+      {
+      }
+
+      ~Adjugate2x2() noexcept = default;
+
+      inline value_type determinant() const
+      {
+        return
+            _arg.template eval<0,0>()*_arg.template eval<1,1>() -
+            _arg.template eval<0,1>()*_arg.template eval<1,0>();
+      }
+
+      template<std::size_t i, std::size_t j>
+      inline value_type eval() const
+      {
+        if constexpr( i == j ) {
+          return _arg.template eval<1-i,1-j>();
+        } else {
+          return -_arg.template eval<i,j>();
+        }
+      }
+
+    private:
+      operand_t<ARG> _arg;
+    };
+
     // Implementation - 3x3 Cofactor Matrix //////////////////////////////////
 
     template<typename traits_T, typename ARG>
@@ -128,6 +185,8 @@ namespace cs {
       using typename ExprBase<traits_T,Cofactor3x3<traits_T,ARG>>::traits_type;
       using typename ExprBase<traits_T,Cofactor3x3<traits_T,ARG>>::value_type;
 
+      static constexpr bool is_reordering = true;
+
       static_assert(if_dimensions_v<traits_type,3,3>);
 
       Cofactor3x3(const ARG& arg) noexcept
@@ -173,7 +232,156 @@ namespace cs {
             :  PLUS;
       }
 
-      const ARG& _arg;
+      operand_t<ARG> _arg;
+    };
+
+    // Implementation - 4x4 Block Inverse ////////////////////////////////////
+
+    /*
+     * NOTE:
+     * A 4x4 matrix M is partitioned into the 2x2 blocks
+     *
+     *     [ A B ]
+     * M = [ C D ], each stored row-major as [ x0 x1 x2 x3 ].
+     *
+     * Using the adjugate X# of a 2x2 block (i.e. X*X# = det(X)*I) yields
+     *
+     * det(M) = det(A)*det(D) + det(B)*det(C) - trace((A#*B)*(D#*C))
+     *
+     *                         [ (det(D)*A - B*(D#*C))#   (det(B)*C - D*(A#*B)#)# ]
+     * inverse(M) = 1/det(M) * [ (det(C)*B - A*(D#*C)#)#  (det(A)*D - C*(A#*B))#  ]
+     *
+     * without requiring any block to be invertible.
+     *
+     * Reference:
+     * "Fast 4x4 Matrix Inverse with SSE SIMD", Eric Zhang; cf. simd::inverse()
+     * in N4/SIMD.h.
+     */
+
+    template<typename value_T>
+    struct Block2x2 {
+      inline static value_T det(const value_T *a)
+      {
+        return a[0]*a[3] - a[1]*a[2];
+      }
+
+      // y = A*B
+      inline static void mul(value_T *y, const value_T *a, const value_T *b)
+      {
+        y[0] = a[0]*b[0] + a[1]*b[2];
+        y[1] = a[0]*b[1] + a[1]*b[3];
+        y[2] = a[2]*b[0] + a[3]*b[2];
+        y[3] = a[2]*b[1] + a[3]*b[3];
+      }
+
+      // y = A#*B
+      inline static void adjMul(value_T *y, const value_T *a, const value_T *b)
+      {
+        y[0] = a[3]*b[0] - a[1]*b[2];
+        y[1] = a[3]*b[1] - a[1]*b[3];
+        y[2] = a[0]*b[2] - a[2]*b[0];
+        y[3] = a[0]*b[3] - a[2]*b[1];
+      }
+
+      // y = A*B#
+      inline static void mulAdj(value_T *y, const value_T *a, const value_T *b)
+      {
+        y[0] = a[0]*b[3] - a[1]*b[2];
+        y[1] = a[1]*b[0] - a[0]*b[1];
+        y[2] = a[2]*b[3] - a[3]*b[2];
+        y[3] = a[3]*b[0] - a[2]*b[1];
+      }
+
+      // trace(A*B)
+      inline static value_T traceMul(const value_T *a, const value_T *b)
+      {
+        return a[0]*b[0] + a[1]*b[2] + a[2]*b[1] + a[3]*b[3];
+      }
+
+      // y = s*A - y
+      inline static void scaleSub(value_T *y, const value_T& s, const value_T *a)
+      {
+        y[0] = s*a[0] - y[0];
+        y[1] = s*a[1] - y[1];
+        y[2] = s*a[2] - y[2];
+        y[3] = s*a[3] - y[3];
+      }
+    };
+
+    template<typename ARG>
+    struct Block4x4Load {
+      template<std::size_t l, typename value_T>
+      inline static void eval(value_T (*blocks)[4], const ARG& arg)
+      {
+        constexpr std::size_t i = l/4;
+        constexpr std::size_t j = l%4;
+
+        blocks[(i/2)*2 + j/2][(i%2)*2 + j%2] = arg.template eval<i,j>();
+      }
+    };
+
+    template<typename traits_T>
+    class BlockInverse4x4 {
+    public:
+      using traits_type = traits_T;
+      using  value_type = typename traits_type::value_type;
+      using  array_type = Array<NoManipulator<RowMajorPolicy<traits_type>>>;
+      using       block = Block2x2<value_type>;
+
+      static_assert(if_dimensions_v<traits_type,4,4>);
+
+      template<typename ARG>
+      BlockInverse4x4(const ARG& arg) noexcept
+      {
+        meta::for_each<16,Block4x4Load<ARG>>(_m, arg);
+
+        _detA = block::det(_m[0]);
+        _detB = block::det(_m[1]);
+        _detC = block::det(_m[2]);
+        _detD = block::det(_m[3]);
+
+        block::adjMul(_AadjB, _m[0], _m[1]);
+        block::adjMul(_DadjC, _m[3], _m[2]);
+      }
+
+      ~BlockInverse4x4() noexcept = default;
+
+      inline value_type determinant() const
+      {
+        return _detA*_detD + _detB*_detC - block::traceMul(_AadjB, _DadjC);
+      }
+
+      inline array_type inverse() const
+      {
+        value_type inv[4][4];
+        block::mul(inv[0], _m[1], _DadjC);
+        block::scaleSub(inv[0], _detD, _m[0]);
+        block::mulAdj(inv[1], _m[3], _AadjB);
+        block::scaleSub(inv[1], _detB, _m[2]);
+        block::mulAdj(inv[2], _m[0], _DadjC);
+        block::scaleSub(inv[2], _detC, _m[1]);
+        block::mul(inv[3], _m[2], _AadjB);
+        block::scaleSub(inv[3], _detA, _m[3]);
+
+        const value_type s = value_type{1}/determinant();
+
+        array_type result;
+        for(std::size_t b = 0; b < 4; b++) {
+          const std::size_t i = (b/2)*2;
+          const std::size_t j = (b%2)*2;
+          result(i + 0, j + 0) =  inv[b][3]*s;
+          result(i + 0, j + 1) = -inv[b][1]*s;
+          result(i + 1, j + 0) = -inv[b][2]*s;
+          result(i + 1, j + 1) =  inv[b][0]*s;
+        }
+        return result;
+      }
+
+    private:
+      value_type _m[4][4];
+      value_type _detA, _detB, _detC, _detD;
+      value_type _AadjB[4];
+      value_type _DadjC[4];
     };
 
     // Implementation - Vector Cross Product /////////////////////////////////
@@ -184,6 +392,8 @@ namespace cs {
       using typename ExprBase<traits_T,Cross<traits_T,ARG1,ARG2>>::traits_type;
       using typename ExprBase<traits_T,Cross<traits_T,ARG1,ARG2>>::value_type;
 
+      static constexpr bool is_reordering = true;
+
       static_assert(if_dimensions_v<traits_type,3,1>);
 
       Cross(const ARG1& arg1, const ARG2& arg2) noexcept
@@ -205,8 +415,8 @@ namespace cs {
       }
 
     private:
-      const ARG1& _arg1;
-      const ARG2& _arg2;
+      operand_t<ARG1> _arg1;
+      operand_t<ARG2> _arg2;
     };
 
     // Implementation - Dot Product //////////////////////////////////////////
@@ -233,15 +443,10 @@ namespace cs {
       using  simd      = SIMD<value_type>;
       using  simd_type = typename simd::simd_type;
 
-      inline static simd_type accumulate(const simd_type& a, const simd_type& b)
-      {
-        return simd::add(a, b);
-      }
-
       template<std::size_t b>
-      inline static simd_type eval(const ARG1& arg1, const ARG2& arg2)
+      inline static void eval(simd_type& x, const ARG1& arg1, const ARG2& arg2)
       {
-        return simd::mul(arg1.block(b), arg2.block(b));
+        x = simd::fmadd(arg1.block(b), arg2.block(b), x);
       }
     };
 
@@ -251,6 +456,8 @@ namespace cs {
       using typename ExprBase<traits_T,Dot<traits_T,INNER,ARG1,ARG2>>::traits_type;
       using typename ExprBase<traits_T,Dot<traits_T,INNER,ARG1,ARG2>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<ARG1>  ||  if_reordering_v<ARG2>;
+
       static_assert(if_dimensions_v<traits_type,1,1>);
 
       Dot(const ARG1& arg1, const ARG2& arg2) noexcept
@@ -270,7 +477,8 @@ namespace cs {
           using simd      = SIMD<value_type>;
           using simd_type = typename simd::simd_type;
 
-          const simd_type x = meta::accumulate<simd_type,simd::blocks(INNER),PROD>(_arg1, _arg2);
+          simd_type x = simd::zero();
+          meta::for_each<simd::blocks(INNER),PROD>(x, _arg1, _arg2);
 
           return simd::scalar(simd::hadd(x));
         }
@@ -279,8 +487,55 @@ namespace cs {
       }
 
     private:
-      const ARG1& _arg1;
-      const ARG2& _arg2;
+      operand_t<ARG1> _arg1;
+      operand_t<ARG2> _arg2;
+    };
+
+    // Implementation - Evaluation ///////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * Eval<> evaluates its argument once into an aligned temporary; all
+     * subsequent accesses read this temporary instead of re-evaluating the
+     * argument's expression.
+     */
+
+    template<typename traits_T, typename ARG>
+    class Eval : public ExprBase<traits_T,Eval<traits_T,ARG>> {
+    public:
+      using typename ExprBase<traits_T,Eval<traits_T,ARG>>::traits_type;
+      using typename ExprBase<traits_T,Eval<traits_T,ARG>>::value_type;
+      using policy_type = RowMajorPolicy<traits_type>;
+      using  array_type = Array<NoManipulator<policy_type>>;
+      using        simd = SIMD<value_type>;
+      using   simd_type = typename simd::simd_type;
+
+      Eval(const ARG& arg) noexcept
+        : _value(arg)
+      {
+      }
+
+      ~Eval() noexcept = default;
+
+      template<std::size_t i, std::size_t j>
+      inline value_type eval() const
+      {
+        return _value.template eval<i,j>();
+      }
+
+      template<typename simd_policy_T, bool check_policy>
+      static constexpr bool is_simd()
+      {
+        return array_type::template is_simd<simd_policy_T,check_policy>();
+      }
+
+      inline simd_type block(const std::size_t b) const
+      {
+        return _value.block(b);
+      }
+
+    private:
+      const array_type _value;
     };
 
     // Implementation - Maximum //////////////////////////////////////////////
@@ -291,6 +546,8 @@ namespace cs {
       using typename ExprBase<traits_T,SMax<traits_T,ARG>>::traits_type;
       using typename ExprBase<traits_T,SMax<traits_T,ARG>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<ARG>;
+
       SMax(const ARG& arg, const value_type scalar) noexcept
         : _arg(arg)
         , _scalar(scalar)
@@ -299,6 +556,11 @@ namespace cs {
 
       ~SMax() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return _arg.size();
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -318,7 +580,7 @@ namespace cs {
       }
 
     private:
-      const ARG& _arg;
+      operand_t<ARG> _arg;
       const value_type _scalar{};
     };
 
@@ -330,6 +592,8 @@ namespace cs {
       using typename ExprBase<traits_T,SMin<traits_T,ARG>>::traits_type;
       using typename ExprBase<traits_T,SMin<traits_T,ARG>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<ARG>;
+
       SMin(const ARG& arg, const value_type scalar) noexcept
         : _arg(arg)
         , _scalar(scalar)
@@ -338,6 +602,11 @@ namespace cs {
 
       ~SMin() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return _arg.size();
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -357,10 +626,263 @@ namespace cs {
       }
 
     private:
-      const ARG& _arg;
+      operand_t<ARG> _arg;
       const value_type _scalar{};
     };
 
+    // Implementation - Reduction ////////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * A reduction maps each element, then combines the mapped elements. The
+     * SIMD path combines whole blocks vertically and the resulting register
+     * horizontally; lanes of the final, partial block beyond Size are padded
+     * with the reduction's neutral value first.
+     */
+
+    template<typename value_T>
+    struct ReduceSum {
+      using value_type = value_T;
+      using       simd = SIMD<value_type>;
+      using  simd_type = typename simd::simd_type;
+
+      inline static value_type pad(const value_type& /*first*/)
+      {
+        return value_type{0};
+      }
+
+      inline static value_type map(const value_type& x)
+      {
+        return x;
+      }
+
+      inline static simd_type map(const simd_type& x)
+      {
+        return x;
+      }
+
+      inline static value_type reduce(const value_type& a, const value_type& b)
+      {
+        return a + b;
+      }
+
+      inline static simd_type reduce(const simd_type& a, const simd_type& b)
+      {
+        return simd::add(a, b);
+      }
+
+      inline static simd_type horizontal(const simd_type& x)
+      {
+        return simd::hadd(x);
+      }
+    };
+
+    template<typename value_T>
+    struct ReduceSumAbs : public ReduceSum<value_T> {
+      using typename ReduceSum<value_T>::value_type;
+      using typename ReduceSum<value_T>::simd;
+      using typename ReduceSum<value_T>::simd_type;
+
+      inline static value_type map(const value_type& x)
+      {
+        return csAbs(x);
+      }
+
+      inline static simd_type map(const simd_type& x)
+      {
+        return simd::abs(x);
+      }
+    };
+
+    template<typename value_T>
+    struct ReduceSumSquares : public ReduceSum<value_T> {
+      using typename ReduceSum<value_T>::value_type;
+      using typename ReduceSum<value_T>::simd;
+      using typename ReduceSum<value_T>::simd_type;
+
+      inline static value_type map(const value_type& x)
+      {
+        return x*x;
+      }
+
+      inline static simd_type map(const simd_type& x)
+      {
+        return simd::mul(x, x);
+      }
+    };
+
+    template<typename value_T>
+    struct ReduceMax {
+      using value_type = value_T;
+      using       simd = SIMD<value_type>;
+      using  simd_type = typename simd::simd_type;
+
+      inline static value_type pad(const value_type& first)
+      {
+        return first;
+      }
+
+      inline static value_type map(const value_type& x)
+      {
+        return x;
+      }
+
+      inline static simd_type map(const simd_type& x)
+      {
+        return x;
+      }
+
+      inline static value_type reduce(const value_type& a, const value_type& b)
+      {
+        return csMax(a, b);
+      }
+
+      inline static simd_type reduce(const simd_type& a, const simd_type& b)
+      {
+        return simd::max(a, b);
+      }
+
+      inline static simd_type horizontal(const simd_type& x)
+      {
+        return simd::hmax(x);
+      }
+    };
+
+    template<typename value_T>
+    struct ReduceMaxAbs : public ReduceMax<value_T> {
+      using typename ReduceMax<value_T>::value_type;
+      using typename ReduceMax<value_T>::simd;
+      using typename ReduceMax<value_T>::simd_type;
+
+      inline static value_type map(const value_type& x)
+      {
+        return csAbs(x);
+      }
+
+      inline static simd_type map(const simd_type& x)
+      {
+        return simd::abs(x);
+      }
+    };
+
+    template<typename value_T>
+    struct ReduceMin {
+      using value_type = value_T;
+      using       simd = SIMD<value_type>;
+      using  simd_type = typename simd::simd_type;
+
+      inline static value_type pad(const value_type& first)
+      {
+        return first;
+      }
+
+      inline static value_type map(const value_type& x)
+      {
+        return x;
+      }
+
+      inline static simd_type map(const simd_type& x)
+      {
+        return x;
+      }
+
+      inline static value_type reduce(const value_type& a, const value_type& b)
+      {
+        return csMin(a, b);
+      }
+
+      inline static simd_type reduce(const simd_type& a, const simd_type& b)
+      {
+        return simd::min(a, b);
+      }
+
+      inline static simd_type horizontal(const simd_type& x)
+      {
+        return simd::hmin(x);
+      }
+    };
+
+    template<typename traits_T, typename OP, typename ARG>
+    struct ReduceElement {
+      using traits_type = traits_T;
+      using policy_type = RowMajorPolicy<traits_type>;
+      using  value_type = typename traits_type::value_type;
+
+      inline static value_type accumulate(const value_type& a, const value_type& b)
+      {
+        return OP::reduce(a, b);
+      }
+
+      template<std::size_t l>
+      inline static value_type eval(const ARG& arg)
+      {
+        constexpr std::size_t i = policy_type::row(l);
+        constexpr std::size_t j = policy_type::column(l);
+
+        return OP::map(arg.template eval<i,j>());
+      }
+    };
+
+    template<typename traits_T, typename OP, typename ARG>
+    struct ReduceBlock {
+      using traits_type = traits_T;
+      using  value_type = typename traits_type::value_type;
+      using        simd = SIMD<value_type>;
+      using   simd_type = typename simd::simd_type;
+
+      template<std::size_t b>
+      inline static void eval(simd_type& y, const ARG& arg)
+      {
+        y = OP::reduce(y, OP::map(arg.block(b)));
+      }
+    };
+
+    template<typename traits_T, typename OP, typename ARG>
+    struct Reduce {
+      using traits_type = traits_T;
+      using  value_type = typename traits_type::value_type;
+
+      /*
+       * NOTE:
+       * The order of the elements is irrelevant to a reduction, but all of
+       * the expression's operands need to share one storage order.
+       */
+      inline static value_type run(const ARG& arg)
+      {
+        if constexpr( check_simd<ARG,RowMajorPolicy<traits_type>>()  ||
+                      check_simd<ARG,ColumnMajorPolicy<traits_type>>() ) {
+          using  simd      = SIMD<value_type>;
+          using  simd_type = typename simd::simd_type;
+          using BLOCK      = ReduceBlock<traits_type,OP,ARG>;
+
+          constexpr std::size_t FullBlocks = traits_type::Size/simd::ElementCount;
+          constexpr std::size_t  TailCount = traits_type::Size%simd::ElementCount;
+
+          simd_type y;
+          if constexpr( TailCount > 0 ) {
+            alignas(simd::Alignment) value_type temp[simd::ElementCount];
+            simd::store(temp, OP::map(arg.block(FullBlocks)));
+            for(std::size_t l = TailCount; l < simd::ElementCount; l++) {
+              temp[l] = OP::pad(temp[0]);
+            }
+            y = simd::load(temp);
+            if constexpr( FullBlocks > 0 ) {
+              meta::for_each<FullBlocks,BLOCK>(y, arg);
+            }
+          } else {
+            y = OP::map(arg.block(FullBlocks - 1));
+            if constexpr( FullBlocks > 1 ) {
+              meta::for_each<FullBlocks-1,BLOCK>(y, arg);
+            }
+          }
+
+          return simd::scalar(OP::horizontal(y));
+        }
+        using ELEMENT = ReduceElement<traits_type,OP,ARG>;
+        return meta::accumulate<value_type,traits_type::Size,ELEMENT>(arg);
+      }
+    };
+
     // Implementation - Matrix/Vector Transposition //////////////////////////
 
     template<typename traits_T, typename ARG>
@@ -369,6 +891,9 @@ namespace cs {
       using typename ExprBase<traits_T,Transpose<traits_T,ARG>>::traits_type;
       using typename ExprBase<traits_T,Transpose<traits_T,ARG>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<ARG>  ||
+          ( traits_type::Rows > 1  &&  traits_type::Columns > 1 );
+
       Transpose(const ARG& arg) noexcept
         : _arg(arg)
       {
@@ -382,8 +907,29 @@ namespace cs {
         return _arg.template eval<j,i>();
       }
 
+      /*
+       * NOTE:
+       * The storage of the transpose equals the argument's storage in the
+       * transposed order; vectors are stored identically in either order.
+       */
+      template<typename simd_policy_T, bool check_policy>
+      static constexpr bool is_simd()
+      {
+        if constexpr( traits_type::Rows == 1  ||  traits_type::Columns == 1 ) {
+          return check_simd<ARG,simd_policy_T,false>();
+        } else if constexpr( check_policy ) {
+          return check_simd<ARG,typename simd_policy_T::transposed_type,check_policy>();
+        }
+        return false;
+      }
+
+      inline simd_type<value_type> block(const std::size_t b) const
+      {
+        return _arg.block(b);
+      }
+
     private:
-      const ARG& _arg;
+      operand_t<ARG> _arg;
     };
 
   } // namespace impl
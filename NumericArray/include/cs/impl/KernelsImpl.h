@@ -0,0 +1,119 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * NOTE:
+ * This file is intentionally NOT guarded against multiple inclusion!
+ * cs/Kernels.h includes it once per ISA after defining CS_KERNELS_NAMESPACE,
+ * CS_KERNELS_SIMD and CS_KERNELS_FMA, and within the matching
+ * CS_TARGET_PUSH() region.
+ */
+
+#if !defined(CS_KERNELS_NAMESPACE)  ||  !defined(CS_KERNELS_SIMD)  ||  !defined(CS_KERNELS_FMA)
+# error "Do not include KernelsImpl.h directly; include cs/Kernels.h!"
+#endif
+
+namespace cs {
+
+  namespace impl {
+
+    namespace CS_KERNELS_NAMESPACE {
+
+      template<typename T>
+      struct Kernels {
+        using       simd = CS_KERNELS_SIMD<T>;
+        using  simd_type = typename simd::simd_type;
+        using value_type = typename simd::value_type;
+
+        static constexpr std::size_t ElementCount = simd::ElementCount;
+
+        /*
+         * NOTE:
+         * The backends only fuse if FMA is enabled globally (cf. __FMA__);
+         * the kernels of an ISA with FMA fuse regardless.
+         */
+        inline static simd_type fmadd(const simd_type& a, const simd_type& b, const simd_type& c)
+        {
+#if CS_KERNELS_FMA
+          if constexpr( sizeof(simd_type) == 32 ) {
+            if constexpr( std::is_same_v<value_type,double> ) {
+              return _mm256_fmadd_pd(a, b, c);
+            } else {
+              return _mm256_fmadd_ps(a, b, c);
+            }
+          }
+#endif
+          return simd::fmadd(a, b, c);
+        }
+
+        static void assign(value_type *dest, const value_type value, const std::size_t count)
+        {
+          const simd_type x = simd::set(value);
+          std::size_t l = 0;
+          for(; l + ElementCount <= count; l += ElementCount) {
+            simd::storeu(dest + l, x);
+          }
+          for(; l < count; l++) {
+            dest[l] = value;
+          }
+        }
+
+        static void copy(value_type *dest, const value_type *src, const std::size_t count)
+        {
+          std::size_t l = 0;
+          for(; l + ElementCount <= count; l += ElementCount) {
+            simd::storeu(dest + l, simd::loadu(src + l));
+          }
+          for(; l < count; l++) {
+            dest[l] = src[l];
+          }
+        }
+
+        static value_type dot(const value_type *a, const value_type *b, const std::size_t count)
+        {
+          simd_type x = simd::zero();
+          std::size_t l = 0;
+          for(; l + ElementCount <= count; l += ElementCount) {
+            x = fmadd(simd::loadu(a + l), simd::loadu(b + l), x);
+          }
+          value_type result = simd::scalar(simd::hadd(x));
+          for(; l < count; l++) {
+            result += a[l]*b[l];
+          }
+          return result;
+        }
+      };
+
+    } // namespace CS_KERNELS_NAMESPACE
+
+  } // namespace impl
+
+} // namespace cs
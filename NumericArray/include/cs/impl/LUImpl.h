@@ -0,0 +1,280 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef LUIMPL_H
+#define LUIMPL_H
+
+#include <utility>
+
+#include <cs/impl/ArrayImpl.h>
+#include <cs/ArrayTraits.h>
+#include <cs/Math.h>
+#include <cs/Meta.h>
+#include <cs/SIMD.h>
+
+namespace cs {
+
+  namespace impl {
+
+    // Implementation - LU Storage ///////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * Each row of the factors is padded to whole SIMD blocks, such that rows
+     * are updated blockwise during elimination.
+     */
+
+    template<typename traits_T>
+    struct LUStorage {
+      using traits_type = traits_T;
+      using  value_type = typename traits_type::value_type;
+      using        simd = SIMD<value_type>;
+      using   simd_type = typename simd::simd_type;
+      using     storage = ArrayStorage<ArrayTraits<value_type,1,traits_type::Columns>>;
+
+      static constexpr std::size_t      N = traits_type::Rows;
+      static constexpr std::size_t Blocks = storage::DataBlocks;
+      static constexpr std::size_t Stride = storage::DataSize;
+
+      static constexpr std::size_t block(const std::size_t j)
+      {
+        return j/simd::ElementCount;
+      }
+    };
+
+    // Implementation - LU Load //////////////////////////////////////////////
+
+    template<typename traits_T, typename ARG>
+    struct LULoad {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+
+      template<std::size_t l>
+      inline static void eval(value_type *U, const ARG& arg)
+      {
+        constexpr std::size_t i = l/lu::N;
+        constexpr std::size_t j = l%lu::N;
+
+        U[i*lu::Stride + j] = arg.template eval<i,j>();
+      }
+    };
+
+    // Implementation - LU Decomposition /////////////////////////////////////
+
+    template<typename traits_T, std::size_t k>
+    struct LUPivot {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+
+      template<std::size_t r>
+      inline static void eval(const value_type *U, std::size_t& p, value_type& max)
+      {
+        constexpr std::size_t i = k + 1 + r;
+
+        const value_type x = csAbs(U[i*lu::Stride + k]);
+        if( x > max ) {
+          max = x;
+          p   = i;
+        }
+      }
+    };
+
+    template<typename traits_T>
+    struct LUBlockSwap {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+      using  simd_type = typename lu::simd_type;
+      using    storage = typename lu::storage;
+
+      template<std::size_t b>
+      inline static void eval(value_type *rowA, value_type *rowB)
+      {
+        const simd_type a = storage::load(rowA, b);
+        storage::store(rowA, b, storage::load(rowB, b));
+        storage::store(rowB, b, a);
+      }
+    };
+
+    template<typename traits_T, std::size_t first>
+    struct LUBlockUpdate {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+      using       simd = typename lu::simd;
+      using  simd_type = typename lu::simd_type;
+      using    storage = typename lu::storage;
+
+      template<std::size_t b>
+      inline static void eval(value_type *rowI, const value_type *rowK, const simd_type& l)
+      {
+        constexpr std::size_t bb = first + b;
+
+        storage::store(rowI, bb, simd::fmadd(l, storage::load(rowK, bb), storage::load(rowI, bb)));
+      }
+    };
+
+    /*
+     * NOTE:
+     * Row i is updated starting at the block containing column k; the
+     * leading columns of both rows are exactly zero and remain unchanged.
+     */
+
+    template<typename traits_T, std::size_t k>
+    struct LUEliminate {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+      using       simd = typename lu::simd;
+      using     UPDATE = LUBlockUpdate<traits_T,lu::block(k)>;
+
+      template<std::size_t r>
+      inline static void eval(value_type *L, value_type *U)
+      {
+        constexpr std::size_t i = k + 1 + r;
+
+        value_type       *rowI = U + i*lu::Stride;
+        const value_type *rowK = U + k*lu::Stride;
+
+        const value_type l = rowI[k]/rowK[k];
+        meta::for_each<lu::Blocks-lu::block(k),UPDATE>(rowI, rowK, simd::set(-l));
+        rowI[k] = value_type{0};
+
+        L[i*lu::Stride + k] = l;
+      }
+    };
+
+    template<typename traits_T>
+    struct LUDecompose {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+
+      template<std::size_t k>
+      inline static void eval(value_type *L, value_type *U, std::size_t *perm, value_type& sign)
+      {
+        constexpr std::size_t N = lu::N;
+
+        std::size_t p = k;
+        value_type max = csAbs(U[k*lu::Stride + k]);
+        if constexpr( k + 1 < N ) {
+          using PIVOT = LUPivot<traits_T,k>;
+          meta::for_each<N-1-k,PIVOT>(U, p, max);
+        }
+
+        if( p != k ) {
+          using SWAP = LUBlockSwap<traits_T>;
+          meta::for_each<lu::Blocks,SWAP>(L + k*lu::Stride, L + p*lu::Stride);
+          meta::for_each<lu::Blocks,SWAP>(U + k*lu::Stride, U + p*lu::Stride);
+          std::swap(perm[k], perm[p]);
+          sign = -sign;
+        }
+
+        // NOTE: A singular column leaves the remaining rows unchanged.
+        if constexpr( k + 1 < N ) {
+          if( max != value_type{0} ) {
+            using ELIMINATE = LUEliminate<traits_T,k>;
+            meta::for_each<N-1-k,ELIMINATE>(L, U);
+          }
+        }
+      }
+    };
+
+    // Implementation - LU Substitution //////////////////////////////////////
+
+    template<typename traits_T, std::size_t first>
+    struct LURowDot {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+
+      inline static value_type accumulate(const value_type& a, const value_type& b)
+      {
+        return a + b;
+      }
+
+      template<std::size_t j>
+      inline static value_type eval(const value_type *row, const value_type *x)
+      {
+        return row[first + j]*x[first + j];
+      }
+    };
+
+    template<typename traits_T>
+    struct LUForward {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+
+      template<std::size_t i>
+      inline static void eval(const value_type *L, value_type *x)
+      {
+        if constexpr( i > 0 ) {
+          using DOT = LURowDot<traits_T,0>;
+          x[i] -= meta::accumulate<value_type,i,DOT>(L + i*lu::Stride, x);
+        }
+      }
+    };
+
+    template<typename traits_T>
+    struct LUBackward {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+
+      template<std::size_t r>
+      inline static void eval(const value_type *U, value_type *x)
+      {
+        constexpr std::size_t i = lu::N - 1 - r;
+
+        if constexpr( r > 0 ) {
+          using DOT = LURowDot<traits_T,i+1>;
+          x[i] -= meta::accumulate<value_type,r,DOT>(U + i*lu::Stride, x);
+        }
+        x[i] /= U[i*lu::Stride + i];
+      }
+    };
+
+    template<typename traits_T>
+    struct LUDiagonal {
+      using         lu = LUStorage<traits_T>;
+      using value_type = typename lu::value_type;
+
+      inline static value_type accumulate(const value_type& a, const value_type& b)
+      {
+        return a*b;
+      }
+
+      template<std::size_t i>
+      inline static value_type eval(const value_type *U)
+      {
+        return U[i*lu::Stride + i];
+      }
+    };
+
+  } // namespace impl
+
+} // namespace cs
+
+#endif // LUIMPL_H
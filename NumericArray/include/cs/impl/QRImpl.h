@@ -0,0 +1,237 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef QRIMPL_H
+#define QRIMPL_H
+
+#include <cs/Math.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  namespace impl {
+
+    /*
+     * NOTE:
+     * The kernels below operate on a row-major MxN array (M >= N), which is
+     * overwritten with R in its upper triangle and the Householder vectors
+     * below the diagonal; the leading element of each vector is an implied 1.
+     */
+
+    // Implementation - Load Matrix //////////////////////////////////////////
+
+    template<std::size_t N, typename ARG>
+    struct QRLoad {
+      template<std::size_t l, typename value_T>
+      inline static void eval(value_T *QR, const ARG& arg)
+      {
+        constexpr std::size_t i = l/N;
+        constexpr std::size_t j = l%N;
+
+        QR[l] = arg.template eval<i,j>();
+      }
+    };
+
+    // Implementation - Householder Reflection ///////////////////////////////
+
+    template<typename value_T, std::size_t N, std::size_t j, std::size_t stride>
+    struct HouseholderDot {
+      inline static value_T accumulate(const value_T& a, const value_T& b)
+      {
+        return a + b;
+      }
+
+      template<std::size_t r>
+      inline static value_T eval(const value_T *QR, const value_T *x)
+      {
+        constexpr std::size_t i = j + 1 + r;
+
+        return QR[i*N + j]*x[i*stride];
+      }
+    };
+
+    template<typename value_T, std::size_t N, std::size_t j, std::size_t stride>
+    struct HouseholderUpdate {
+      template<std::size_t r>
+      inline static void eval(const value_T *QR, value_T *x, const value_T& w)
+      {
+        constexpr std::size_t i = j + 1 + r;
+
+        x[i*stride] = x[i*stride] - w*QR[i*N + j];
+      }
+    };
+
+    template<typename value_T, std::size_t N, std::size_t j>
+    struct HouseholderScale {
+      template<std::size_t r>
+      inline static void eval(value_T *QR, const value_T& s)
+      {
+        constexpr std::size_t i = j + 1 + r;
+
+        QR[i*N + j] = QR[i*N + j]*s;
+      }
+    };
+
+    /*
+     * NOTE:
+     * Applies H(j) = I - tau(j)*v(j)*transpose(v(j)) in place to the M
+     * elements of x, which are stride elements apart.
+     */
+    template<typename value_T, std::size_t M, std::size_t N, std::size_t j, std::size_t stride>
+    struct HouseholderReflect {
+      inline static void run(const value_T *QR, const value_T *tau, value_T *x)
+      {
+        using DOT    = HouseholderDot<value_T,N,j,stride>;
+        using UPDATE = HouseholderUpdate<value_T,N,j,stride>;
+
+        value_T w = x[j*stride];
+        if constexpr( j + 1 < M ) {
+          w = w + meta::accumulate<value_T,M-1-j,DOT>(QR, x);
+        }
+        w = tau[j]*w;
+
+        x[j*stride] = x[j*stride] - w;
+        if constexpr( j + 1 < M ) {
+          meta::for_each<M-1-j,UPDATE>(QR, x, w);
+        }
+      }
+    };
+
+    // Implementation - QR Decomposition /////////////////////////////////////
+
+    template<typename value_T, std::size_t M, std::size_t N, std::size_t j>
+    struct QRColumnReflect {
+      template<std::size_t r>
+      inline static void eval(value_T *QR, const value_T *tau)
+      {
+        constexpr std::size_t k = j + 1 + r;
+
+        HouseholderReflect<value_T,M,N,j,N>::run(QR, tau, QR + k);
+      }
+    };
+
+    /*
+     * NOTE:
+     * The sign of beta is chosen opposite to the diagonal element to avoid
+     * cancellation. A column which is already zero below the diagonal
+     * yields tau = 0, i.e. H = I.
+     */
+    template<typename value_T, std::size_t M, std::size_t N>
+    struct QRColumn {
+      template<std::size_t j>
+      inline static void eval(value_T *QR, value_T *tau)
+      {
+        tau[j] = value_T{0};
+        if constexpr( j + 1 < M ) {
+          const value_T     x = QR[j*N + j];
+          const value_T sigma = meta::accumulate<value_T,M-1-j,HouseholderDot<value_T,N,j,N>>(QR, QR + j);
+          if( sigma != value_T{0} ) {
+            const value_T beta = -csCopySign(csSqrt(x*x + sigma), x);
+            tau[j] = (beta - x)/beta;
+            meta::for_each<M-1-j,HouseholderScale<value_T,N,j>>(QR, value_T{1}/(x - beta));
+            QR[j*N + j] = beta;
+          }
+        }
+
+        if constexpr( j + 1 < N ) {
+          meta::for_each<N-1-j,QRColumnReflect<value_T,M,N,j>>(QR, tau);
+        }
+      }
+    };
+
+    // Implementation - Apply Q //////////////////////////////////////////////
+
+    /*
+     * NOTE:
+     * transpose(Q)*x = H(N-1)*...*H(0)*x and Q*x = H(0)*...*H(N-1)*x.
+     */
+
+    template<typename value_T, std::size_t M, std::size_t N>
+    struct QRApplyTransposed {
+      template<std::size_t j>
+      inline static void eval(const value_T *QR, const value_T *tau, value_T *x)
+      {
+        HouseholderReflect<value_T,M,N,j,1>::run(QR, tau, x);
+      }
+    };
+
+    template<typename value_T, std::size_t M, std::size_t N>
+    struct QRApply {
+      template<std::size_t r>
+      inline static void eval(const value_T *QR, const value_T *tau, value_T *x)
+      {
+        constexpr std::size_t j = N - 1 - r;
+
+        HouseholderReflect<value_T,M,N,j,1>::run(QR, tau, x);
+      }
+    };
+
+    // Implementation - Back Substitution ////////////////////////////////////
+
+    template<typename value_T, std::size_t N, std::size_t i>
+    struct UpperDot {
+      inline static value_T accumulate(const value_T& a, const value_T& b)
+      {
+        return a + b;
+      }
+
+      template<std::size_t r>
+      inline static value_T eval(const value_T *R, const value_T *x)
+      {
+        constexpr std::size_t k = i + 1 + r;
+
+        return R[i*N + k]*x[k];
+      }
+    };
+
+    /*
+     * NOTE:
+     * Solves R*y = x in place, where R is the upper NxN triangle.
+     */
+    template<typename value_T, std::size_t N>
+    struct UpperBackward {
+      template<std::size_t r>
+      inline static void eval(const value_T *R, value_T *x)
+      {
+        constexpr std::size_t i = N - 1 - r;
+
+        if constexpr( r > 0 ) {
+          x[i] = x[i] - meta::accumulate<value_T,r,UpperDot<value_T,N,i>>(R, x);
+        }
+        x[i] = x[i]/R[i*N + i];
+      }
+    };
+
+  } // namespace impl
+
+} // namespace cs
+
+#endif // QRIMPL_H
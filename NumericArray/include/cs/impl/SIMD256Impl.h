@@ -0,0 +1,401 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef SIMD256IMPL_H
+#define SIMD256IMPL_H
+
+#include <cstddef>
+
+#include <immintrin.h> // AVX
+
+#include <cs/impl/TargetImpl.h>
+
+CS_TARGET_PUSH("avx")
+
+namespace cs {
+
+  ////// Traits //////////////////////////////////////////////////////////////
+
+  template<typename T>
+  struct SIMD256traits {
+    // SFINAE
+  };
+
+  template<>
+  struct SIMD256traits<double> {
+    using  mask_type = __m256d;
+    using  simd_type = __m256d;
+    using value_type = double;
+
+    inline static __m256d zero()
+    {
+      return _mm256_setzero_pd();
+    }
+  };
+
+  template<>
+  struct SIMD256traits<float> {
+    using  mask_type = __m256;
+    using  simd_type = __m256;
+    using value_type = float;
+
+    inline static __m256 zero()
+    {
+      return _mm256_setzero_ps();
+    }
+  };
+
+  ////// Implementation //////////////////////////////////////////////////////
+
+  template<typename T>
+  struct SIMD256 {
+    using  simd_traits = SIMD256traits<T>;
+    using  mask_type   = typename simd_traits::mask_type;
+    using  simd_type   = typename simd_traits::simd_type;
+    using value_type   = typename simd_traits::value_type;
+
+    static inline constexpr std::size_t    Alignment = sizeof(simd_type);
+    static inline constexpr std::size_t ElementCount = sizeof(simd_type)/sizeof(value_type);
+
+    inline static constexpr std::size_t blocks(const std::size_t count)
+    {
+      return (count + ElementCount - 1)/ElementCount;
+    }
+
+    inline static constexpr std::size_t size(const std::size_t count)
+    {
+      return blocks(count)*ElementCount;
+    }
+
+    inline static simd_type zero()
+    {
+      return simd_traits::zero();
+    }
+
+    /*
+     * NOTE:
+     * AVX masks select elements by their sign bit; the first count elements
+     * are selected.
+     */
+
+    inline static __m256i mask_pd(const std::size_t count)
+    {
+      const __m256d index = _mm256_set_pd(3, 2, 1, 0);
+      return _mm256_castpd_si256(_mm256_cmp_pd(index, _mm256_set1_pd(double(count)), _CMP_LT_OQ));
+    }
+
+    inline static __m256i mask_ps(const std::size_t count)
+    {
+      const __m256 index = _mm256_set_ps(7, 6, 5, 4, 3, 2, 1, 0);
+      return _mm256_castps_si256(_mm256_cmp_ps(index, _mm256_set1_ps(float(count)), _CMP_LT_OQ));
+    }
+
+    // Interface - double ////////////////////////////////////////////////////
+
+    inline static __m256d load(const double *src)
+    {
+      return _mm256_load_pd(src);
+    }
+
+    inline static __m256d loadu(const double *src)
+    {
+      return _mm256_loadu_pd(src);
+    }
+
+    inline static __m256d load(const double *src, const std::size_t count)
+    {
+      return _mm256_maskload_pd(src, mask_pd(count));
+    }
+
+    inline static __m256d set(const double& x)
+    {
+      return _mm256_set1_pd(x);
+    }
+
+    inline static void store(double *dest, const __m256d& x)
+    {
+      _mm256_store_pd(dest, x);
+    }
+
+    inline static void storeu(double *dest, const __m256d& x)
+    {
+      _mm256_storeu_pd(dest, x);
+    }
+
+    inline static void store(double *dest, const __m256d& x, const std::size_t count)
+    {
+      _mm256_maskstore_pd(dest, mask_pd(count), x);
+    }
+
+    inline static __m256d add(const __m256d& a, const __m256d& b)
+    {
+      return _mm256_add_pd(a, b);
+    }
+
+    inline static __m256d sub(const __m256d& a, const __m256d& b)
+    {
+      return _mm256_sub_pd(a, b);
+    }
+
+    inline static __m256d mul(const __m256d& a, const __m256d& b)
+    {
+      return _mm256_mul_pd(a, b);
+    }
+
+    inline static __m256d fmadd(const __m256d& a, const __m256d& b, const __m256d& c)
+    {
+#if defined(__FMA__)
+      return _mm256_fmadd_pd(a, b, c);
+#else
+      return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+    }
+
+    inline static __m256d div(const __m256d& a, const __m256d& b)
+    {
+      return _mm256_div_pd(a, b);
+    }
+
+    inline static __m256d sqrt(const __m256d& x)
+    {
+      return _mm256_sqrt_pd(x);
+    }
+
+    inline static __m256d min(const __m256d& a, const __m256d& b)
+    {
+      return _mm256_min_pd(a, b);
+    }
+
+    inline static __m256d max(const __m256d& a, const __m256d& b)
+    {
+      return _mm256_max_pd(a, b);
+    }
+
+    inline static double scalar(const __m256d& x)
+    {
+      return _mm256_cvtsd_f64(x);
+    }
+
+    inline static __m256d hadd(const __m256d& x)
+    {
+      // NOTE: Swap 128bit lanes first, then swap elements within each lane.
+      const __m256d temp = _mm256_add_pd(x,    _mm256_permute2f128_pd(x, x, 0x01));
+      return               _mm256_add_pd(temp, _mm256_permute_pd(temp, 0x05));
+    }
+
+    inline static __m256d hmin(const __m256d& x)
+    {
+      const __m256d temp = _mm256_min_pd(x,    _mm256_permute2f128_pd(x, x, 0x01));
+      return               _mm256_min_pd(temp, _mm256_permute_pd(temp, 0x05));
+    }
+
+    inline static __m256d hmax(const __m256d& x)
+    {
+      const __m256d temp = _mm256_max_pd(x,    _mm256_permute2f128_pd(x, x, 0x01));
+      return               _mm256_max_pd(temp, _mm256_permute_pd(temp, 0x05));
+    }
+
+    inline static __m256d abs(const __m256d& x)
+    {
+      return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+    }
+
+    inline static __m256d copysign(const __m256d& x, const __m256d& s)
+    {
+      const __m256d sign = _mm256_set1_pd(-0.0);
+      return _mm256_or_pd(_mm256_andnot_pd(sign, x), _mm256_and_pd(sign, s));
+    }
+
+    inline static __m256d cmple(const __m256d& a, const __m256d& b)
+    {
+      return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+    }
+
+    inline static __m256d cmplt(const __m256d& a, const __m256d& b)
+    {
+      return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+    }
+
+    inline static __m256d select(const __m256d& mask, const __m256d& a, const __m256d& b)
+    {
+      return _mm256_blendv_pd(b, a, mask);
+    }
+
+    inline static int movemask(const __m256d& mask)
+    {
+      return _mm256_movemask_pd(mask);
+    }
+
+    // Interface - float /////////////////////////////////////////////////////
+
+    inline static __m256 load(const float *src)
+    {
+      return _mm256_load_ps(src);
+    }
+
+    inline static __m256 loadu(const float *src)
+    {
+      return _mm256_loadu_ps(src);
+    }
+
+    inline static __m256 load(const float *src, const std::size_t count)
+    {
+      return _mm256_maskload_ps(src, mask_ps(count));
+    }
+
+    inline static __m256 set(const float& x)
+    {
+      return _mm256_set1_ps(x);
+    }
+
+    inline static void store(float *dest, const __m256& x)
+    {
+      _mm256_store_ps(dest, x);
+    }
+
+    inline static void storeu(float *dest, const __m256& x)
+    {
+      _mm256_storeu_ps(dest, x);
+    }
+
+    inline static void store(float *dest, const __m256& x, const std::size_t count)
+    {
+      _mm256_maskstore_ps(dest, mask_ps(count), x);
+    }
+
+    inline static __m256 add(const __m256& a, const __m256& b)
+    {
+      return _mm256_add_ps(a, b);
+    }
+
+    inline static __m256 sub(const __m256& a, const __m256& b)
+    {
+      return _mm256_sub_ps(a, b);
+    }
+
+    inline static __m256 mul(const __m256& a, const __m256& b)
+    {
+      return _mm256_mul_ps(a, b);
+    }
+
+    inline static __m256 fmadd(const __m256& a, const __m256& b, const __m256& c)
+    {
+#if defined(__FMA__)
+      return _mm256_fmadd_ps(a, b, c);
+#else
+      return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+    }
+
+    inline static __m256 div(const __m256& a, const __m256& b)
+    {
+      return _mm256_div_ps(a, b);
+    }
+
+    inline static __m256 sqrt(const __m256& x)
+    {
+      return _mm256_sqrt_ps(x);
+    }
+
+    inline static __m256 min(const __m256& a, const __m256& b)
+    {
+      return _mm256_min_ps(a, b);
+    }
+
+    inline static __m256 max(const __m256& a, const __m256& b)
+    {
+      return _mm256_max_ps(a, b);
+    }
+
+    inline static float scalar(const __m256& x)
+    {
+      return _mm256_cvtss_f32(x);
+    }
+
+    inline static __m256 hadd(const __m256& x)
+    {
+      // NOTE: Swap 128bit lanes first, then reduce within each lane.
+      const __m256 temp1 = _mm256_add_ps(x,     _mm256_permute2f128_ps(x, x, 0x01));
+      const __m256 temp2 = _mm256_add_ps(temp1, _mm256_permute_ps(temp1, _MM_SHUFFLE(2, 3, 0, 1)));
+      return               _mm256_add_ps(temp2, _mm256_permute_ps(temp2, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+    inline static __m256 hmin(const __m256& x)
+    {
+      const __m256 temp1 = _mm256_min_ps(x,     _mm256_permute2f128_ps(x, x, 0x01));
+      const __m256 temp2 = _mm256_min_ps(temp1, _mm256_permute_ps(temp1, _MM_SHUFFLE(2, 3, 0, 1)));
+      return               _mm256_min_ps(temp2, _mm256_permute_ps(temp2, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+    inline static __m256 hmax(const __m256& x)
+    {
+      const __m256 temp1 = _mm256_max_ps(x,     _mm256_permute2f128_ps(x, x, 0x01));
+      const __m256 temp2 = _mm256_max_ps(temp1, _mm256_permute_ps(temp1, _MM_SHUFFLE(2, 3, 0, 1)));
+      return               _mm256_max_ps(temp2, _mm256_permute_ps(temp2, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+    inline static __m256 abs(const __m256& x)
+    {
+      return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+    }
+
+    inline static __m256 copysign(const __m256& x, const __m256& s)
+    {
+      const __m256 sign = _mm256_set1_ps(-0.0f);
+      return _mm256_or_ps(_mm256_andnot_ps(sign, x), _mm256_and_ps(sign, s));
+    }
+
+    inline static __m256 cmple(const __m256& a, const __m256& b)
+    {
+      return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+    }
+
+    inline static __m256 cmplt(const __m256& a, const __m256& b)
+    {
+      return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+    }
+
+    inline static __m256 select(const __m256& mask, const __m256& a, const __m256& b)
+    {
+      return _mm256_blendv_ps(b, a, mask);
+    }
+
+    inline static int movemask(const __m256& mask)
+    {
+      return _mm256_movemask_ps(mask);
+    }
+  };
+
+} // namespace cs
+
+CS_TARGET_POP()
+
+#endif // SIMD256IMPL_H
@@ -0,0 +1,381 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef SIMD512IMPL_H
+#define SIMD512IMPL_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <immintrin.h> // AVX-512
+
+#include <cs/impl/TargetImpl.h>
+
+CS_TARGET_PUSH("avx512f")
+
+namespace cs {
+
+  ////// Traits //////////////////////////////////////////////////////////////
+
+  template<typename T>
+  struct SIMD512traits {
+    // SFINAE
+  };
+
+  template<>
+  struct SIMD512traits<double> {
+    using  mask_type = __mmask8;
+    using  simd_type = __m512d;
+    using value_type = double;
+
+    inline static __m512d zero()
+    {
+      return _mm512_setzero_pd();
+    }
+  };
+
+  template<>
+  struct SIMD512traits<float> {
+    using  mask_type = __mmask16;
+    using  simd_type = __m512;
+    using value_type = float;
+
+    inline static __m512 zero()
+    {
+      return _mm512_setzero_ps();
+    }
+  };
+
+  ////// Implementation //////////////////////////////////////////////////////
+
+  /*
+   * NOTE:
+   * The final, partial block of an array is accessed using mask registers.
+   * Hence arrays are NOT padded to a multiple of ElementCount and only
+   * aligned to their value_type; all memory accesses are unaligned.
+   */
+
+  template<typename T>
+  struct SIMD512 {
+    using  simd_traits = SIMD512traits<T>;
+    using  mask_type   = typename simd_traits::mask_type;
+    using  simd_type   = typename simd_traits::simd_type;
+    using value_type   = typename simd_traits::value_type;
+
+    static inline constexpr std::size_t    Alignment = alignof(value_type);
+    static inline constexpr std::size_t ElementCount = sizeof(simd_type)/sizeof(value_type);
+
+    inline static constexpr std::size_t blocks(const std::size_t count)
+    {
+      return (count + ElementCount - 1)/ElementCount;
+    }
+
+    inline static constexpr std::size_t size(const std::size_t count)
+    {
+      return count;
+    }
+
+    inline static constexpr mask_type mask(const std::size_t count)
+    {
+      return static_cast<mask_type>((std::uint32_t{1} << count) - 1);
+    }
+
+    inline static simd_type zero()
+    {
+      return simd_traits::zero();
+    }
+
+    // Interface - double ////////////////////////////////////////////////////
+
+    inline static __m512d load(const double *src)
+    {
+      return _mm512_loadu_pd(src);
+    }
+
+    inline static __m512d loadu(const double *src)
+    {
+      return _mm512_loadu_pd(src);
+    }
+
+    inline static __m512d load(const double *src, const std::size_t count)
+    {
+      return _mm512_maskz_loadu_pd(mask(count), src);
+    }
+
+    inline static __m512d set(const double& x)
+    {
+      return _mm512_set1_pd(x);
+    }
+
+    inline static void store(double *dest, const __m512d& x)
+    {
+      _mm512_storeu_pd(dest, x);
+    }
+
+    inline static void storeu(double *dest, const __m512d& x)
+    {
+      _mm512_storeu_pd(dest, x);
+    }
+
+    inline static void store(double *dest, const __m512d& x, const std::size_t count)
+    {
+      _mm512_mask_storeu_pd(dest, mask(count), x);
+    }
+
+    inline static __m512d add(const __m512d& a, const __m512d& b)
+    {
+      return _mm512_add_pd(a, b);
+    }
+
+    inline static __m512d sub(const __m512d& a, const __m512d& b)
+    {
+      return _mm512_sub_pd(a, b);
+    }
+
+    inline static __m512d mul(const __m512d& a, const __m512d& b)
+    {
+      return _mm512_mul_pd(a, b);
+    }
+
+    inline static __m512d fmadd(const __m512d& a, const __m512d& b, const __m512d& c)
+    {
+      return _mm512_fmadd_pd(a, b, c);
+    }
+
+    inline static __m512d div(const __m512d& a, const __m512d& b)
+    {
+      return _mm512_div_pd(a, b);
+    }
+
+    inline static __m512d sqrt(const __m512d& x)
+    {
+      return _mm512_sqrt_pd(x);
+    }
+
+    inline static __m512d min(const __m512d& a, const __m512d& b)
+    {
+      return _mm512_min_pd(a, b);
+    }
+
+    inline static __m512d max(const __m512d& a, const __m512d& b)
+    {
+      return _mm512_max_pd(a, b);
+    }
+
+    inline static double scalar(const __m512d& x)
+    {
+      return _mm512_cvtsd_f64(x);
+    }
+
+    inline static __m512d hadd(const __m512d& x)
+    {
+      return _mm512_set1_pd(_mm512_reduce_add_pd(x));
+    }
+
+    inline static __m512d hmin(const __m512d& x)
+    {
+      return _mm512_set1_pd(_mm512_reduce_min_pd(x));
+    }
+
+    inline static __m512d hmax(const __m512d& x)
+    {
+      return _mm512_set1_pd(_mm512_reduce_max_pd(x));
+    }
+
+    inline static __m512d abs(const __m512d& x)
+    {
+      return _mm512_abs_pd(x);
+    }
+
+    inline static __m512d copysign(const __m512d& x, const __m512d& s)
+    {
+      // NOTE: 0xD8 selects the bits of s where sign is set, else those of x.
+      const __m512i sign = _mm512_set1_epi64(INT64_MIN);
+      return _mm512_castsi512_pd(_mm512_ternarylogic_epi64(_mm512_castpd_si512(x),
+                                                           _mm512_castpd_si512(s), sign, 0xD8));
+    }
+
+    inline static __mmask8 cmple(const __m512d& a, const __m512d& b)
+    {
+      return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ);
+    }
+
+    inline static __mmask8 cmplt(const __m512d& a, const __m512d& b)
+    {
+      return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+    }
+
+    inline static __m512d select(const __mmask8& mask, const __m512d& a, const __m512d& b)
+    {
+      return _mm512_mask_blend_pd(mask, b, a);
+    }
+
+    inline static int movemask(const __mmask8& mask)
+    {
+      return static_cast<int>(mask);
+    }
+
+    // Interface - float /////////////////////////////////////////////////////
+
+    inline static __m512 load(const float *src)
+    {
+      return _mm512_loadu_ps(src);
+    }
+
+    inline static __m512 loadu(const float *src)
+    {
+      return _mm512_loadu_ps(src);
+    }
+
+    inline static __m512 load(const float *src, const std::size_t count)
+    {
+      return _mm512_maskz_loadu_ps(mask(count), src);
+    }
+
+    inline static __m512 set(const float& x)
+    {
+      return _mm512_set1_ps(x);
+    }
+
+    inline static void store(float *dest, const __m512& x)
+    {
+      _mm512_storeu_ps(dest, x);
+    }
+
+    inline static void storeu(float *dest, const __m512& x)
+    {
+      _mm512_storeu_ps(dest, x);
+    }
+
+    inline static void store(float *dest, const __m512& x, const std::size_t count)
+    {
+      _mm512_mask_storeu_ps(dest, mask(count), x);
+    }
+
+    inline static __m512 add(const __m512& a, const __m512& b)
+    {
+      return _mm512_add_ps(a, b);
+    }
+
+    inline static __m512 sub(const __m512& a, const __m512& b)
+    {
+      return _mm512_sub_ps(a, b);
+    }
+
+    inline static __m512 mul(const __m512& a, const __m512& b)
+    {
+      return _mm512_mul_ps(a, b);
+    }
+
+    inline static __m512 fmadd(const __m512& a, const __m512& b, const __m512& c)
+    {
+      return _mm512_fmadd_ps(a, b, c);
+    }
+
+    inline static __m512 div(const __m512& a, const __m512& b)
+    {
+      return _mm512_div_ps(a, b);
+    }
+
+    inline static __m512 sqrt(const __m512& x)
+    {
+      return _mm512_sqrt_ps(x);
+    }
+
+    inline static __m512 min(const __m512& a, const __m512& b)
+    {
+      return _mm512_min_ps(a, b);
+    }
+
+    inline static __m512 max(const __m512& a, const __m512& b)
+    {
+      return _mm512_max_ps(a, b);
+    }
+
+    inline static float scalar(const __m512& x)
+    {
+      return _mm512_cvtss_f32(x);
+    }
+
+    inline static __m512 hadd(const __m512& x)
+    {
+      return _mm512_set1_ps(_mm512_reduce_add_ps(x));
+    }
+
+    inline static __m512 hmin(const __m512& x)
+    {
+      return _mm512_set1_ps(_mm512_reduce_min_ps(x));
+    }
+
+    inline static __m512 hmax(const __m512& x)
+    {
+      return _mm512_set1_ps(_mm512_reduce_max_ps(x));
+    }
+
+    inline static __m512 abs(const __m512& x)
+    {
+      return _mm512_abs_ps(x);
+    }
+
+    inline static __m512 copysign(const __m512& x, const __m512& s)
+    {
+      // NOTE: 0xD8 selects the bits of s where sign is set, else those of x.
+      const __m512i sign = _mm512_set1_epi32(INT32_MIN);
+      return _mm512_castsi512_ps(_mm512_ternarylogic_epi32(_mm512_castps_si512(x),
+                                                           _mm512_castps_si512(s), sign, 0xD8));
+    }
+
+    inline static __mmask16 cmple(const __m512& a, const __m512& b)
+    {
+      return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ);
+    }
+
+    inline static __mmask16 cmplt(const __m512& a, const __m512& b)
+    {
+      return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+    }
+
+    inline static __m512 select(const __mmask16& mask, const __m512& a, const __m512& b)
+    {
+      return _mm512_mask_blend_ps(mask, b, a);
+    }
+
+    inline static int movemask(const __mmask16& mask)
+    {
+      return static_cast<int>(mask);
+    }
+  };
+
+} // namespace cs
+
+CS_TARGET_POP()
+
+#endif // SIMD512IMPL_H
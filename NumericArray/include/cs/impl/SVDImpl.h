@@ -0,0 +1,132 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef SVDIMPL_H
+#define SVDIMPL_H
+
+#include <cs/Math.h>
+#include <cs/Meta.h>
+
+namespace cs {
+
+  namespace impl {
+
+    /*
+     * NOTE:
+     * One-sided (Hestenes) Jacobi rotates pairs of columns of a row-major
+     * MxN array U until all columns are mutually orthogonal; the same
+     * rotations are accumulated in the NxN array V. Hence A*V = U, where the
+     * norms of U's columns are the singular values of A.
+     */
+
+    // Implementation - Load Matrix //////////////////////////////////////////
+
+    template<std::size_t N, typename ARG>
+    struct SVDLoad {
+      template<std::size_t l, typename value_T>
+      inline static void eval(value_T *U, const ARG& arg)
+      {
+        constexpr std::size_t i = l/N;
+        constexpr std::size_t j = l%N;
+
+        U[l] = arg.template eval<i,j>();
+      }
+    };
+
+    // Implementation - Jacobi Rotation //////////////////////////////////////
+
+    template<typename value_T, std::size_t N, std::size_t p, std::size_t q>
+    struct SVDColumnDot {
+      inline static value_T accumulate(const value_T& a, const value_T& b)
+      {
+        return a + b;
+      }
+
+      template<std::size_t i>
+      inline static value_T eval(const value_T *U)
+      {
+        return U[i*N + p]*U[i*N + q];
+      }
+    };
+
+    template<std::size_t N, std::size_t p, std::size_t q>
+    struct SVDColumnRotate {
+      template<std::size_t i, typename value_T>
+      inline static void eval(value_T *U, const value_T& c, const value_T& s)
+      {
+        const value_T up = U[i*N + p];
+        const value_T uq = U[i*N + q];
+        U[i*N + p] = c*up - s*uq;
+        U[i*N + q] = s*up + c*uq;
+      }
+    };
+
+    /*
+     * NOTE:
+     * The rotation angle is the smaller root of t^2 + 2*zeta*t - 1 = 0,
+     * which orthogonalizes columns p and q. Pairs whose cosine is below tol
+     * are skipped.
+     */
+    template<typename value_T, std::size_t M, std::size_t N>
+    struct SVDRotate {
+      template<std::size_t l>
+      inline static void eval(value_T *U, value_T *V, const value_T& tol, bool& rotated)
+      {
+        constexpr std::size_t p = l/N;
+        constexpr std::size_t q = l%N;
+
+        if constexpr( p < q ) {
+          const value_T alpha = meta::accumulate<value_T,M,SVDColumnDot<value_T,N,p,p>>(U);
+          const value_T  beta = meta::accumulate<value_T,M,SVDColumnDot<value_T,N,q,q>>(U);
+          const value_T gamma = meta::accumulate<value_T,M,SVDColumnDot<value_T,N,p,q>>(U);
+
+          if( !(csAbs(gamma) > tol*csSqrt(alpha*beta)) ) {
+            return;
+          }
+
+          const value_T zeta = (beta - alpha)/(value_T{2}*gamma);
+          const value_T    t = csCopySign(value_T{1}/(csAbs(zeta) + csSqrt(value_T{1} + zeta*zeta)), zeta);
+          const value_T    c = value_T{1}/csSqrt(value_T{1} + t*t);
+          const value_T    s = c*t;
+
+          meta::for_each<M,SVDColumnRotate<N,p,q>>(U, c, s);
+          meta::for_each<N,SVDColumnRotate<N,p,q>>(V, c, s);
+
+          rotated = true;
+        }
+      }
+    };
+
+  } // namespace impl
+
+} // namespace cs
+
+#endif // SVDIMPL_H
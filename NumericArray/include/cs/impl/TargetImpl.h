@@ -0,0 +1,59 @@
+/****************************************************************************
+** Copyright (c) 2026, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef TARGETIMPL_H
+#define TARGETIMPL_H
+
+/*
+ * NOTE:
+ * GCC and Clang only allow intrinsics of an instruction set extension in
+ * functions compiled for that extension. CS_TARGET() annotates a single
+ * function, CS_TARGET_PUSH()/CS_TARGET_POP() annotate all functions
+ * (including templates) defined in between.
+ */
+
+#define CS_PRAGMA(x)  _Pragma(#x)
+
+#if defined(__clang__)
+# define CS_TARGET(isa)       __attribute__((target(isa)))
+# define CS_TARGET_PUSH(isa)  CS_PRAGMA(clang attribute push(__attribute__((target(isa))), apply_to = function))
+# define CS_TARGET_POP()      CS_PRAGMA(clang attribute pop)
+#elif defined(__GNUC__)
+# define CS_TARGET(isa)       __attribute__((target(isa)))
+# define CS_TARGET_PUSH(isa)  CS_PRAGMA(GCC push_options) CS_PRAGMA(GCC target(isa))
+# define CS_TARGET_POP()      CS_PRAGMA(GCC pop_options)
+#else
+# define CS_TARGET(isa)
+# define CS_TARGET_PUSH(isa)
+# define CS_TARGET_POP()
+#endif
+
+#endif // TARGETIMPL_H
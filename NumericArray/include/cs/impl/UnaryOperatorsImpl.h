@@ -49,6 +49,8 @@ namespace cs {
       using typename ExprBase<traits_T,UnaMinus<traits_T,OP>>::traits_type;
       using typename ExprBase<traits_T,UnaMinus<traits_T,OP>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<OP>;
+
       UnaMinus(const OP& op) noexcept
         : _op(op)
       {
@@ -56,6 +58,11 @@ namespace cs {
 
       ~UnaMinus() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return _op.size();
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -76,7 +83,7 @@ namespace cs {
       }
 
     private:
-      const OP& _op;
+      operand_t<OP> _op;
     };
 
     // Implementation - Unary Plus ///////////////////////////////////////////
@@ -89,6 +96,8 @@ namespace cs {
       using typename ExprBase<traits_T,UnaPlus<traits_T,OP>>::traits_type;
       using typename ExprBase<traits_T,UnaPlus<traits_T,OP>>::value_type;
 
+      static constexpr bool is_reordering = if_reordering_v<OP>;
+
       UnaPlus(const OP& op) noexcept
         : _op(op)
       {
@@ -96,6 +105,11 @@ namespace cs {
 
       ~UnaPlus() noexcept = default;
 
+      inline std::size_t size() const
+      {
+        return _op.size();
+      }
+
       template<std::size_t i, std::size_t j>
       inline value_type eval() const
       {
@@ -114,7 +128,7 @@ namespace cs {
       }
 
     private:
-      const OP& _op;
+      operand_t<OP> _op;
     };
 
   } // namespace impl
@@ -1,7 +1,14 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 
 #include <catch.hpp>
 
+#include <cs/ArrayBatch.h>
+#include <cs/DynamicArray.h>
+#include <cs/Kernels.h>
+
 #include "TestArrayEqual.h"
 
 template<typename value_T>
@@ -41,6 +48,35 @@ namespace impl {
     return M;
   }
 
+  template<typename value_T, std::size_t N>
+  cs::NumericArray<value_T,N,N> createSPD(const value_T shift = value_T{0})
+  {
+    cs::NumericArray<value_T,N,N> A;
+    for(std::size_t i = 0; i < N; i++) {
+      for(std::size_t j = 0; j < N; j++) {
+        const std::size_t d = i < j
+            ? j - i
+            : i - j;
+        A(i, j) = d == 0
+            ? value_T{8} + shift
+            : d < 3 ? value_T(3 - d) : value_T{0};
+      }
+    }
+    return A;
+  }
+
+  template<typename value_T>
+  value_T eigenResidual(const _Matrix<value_T>& A, const _Vector<value_T>& w, const _Matrix<value_T>& V)
+  {
+    _Matrix<value_T> D;
+    for(std::size_t i = 0; i < 3; i++) {
+      D(i, i) = w(i, 0);
+    }
+    const _Matrix<value_T> R = A*V - V*D;
+    const _Matrix<value_T> I = cs::transpose(V)*V - cs::identity<typename _Matrix<value_T>::traits_type>();
+    return csMax(cs::normInf(R), cs::normInf(I));
+  }
+
   template<typename array_T>
   void print(const array_T& array, const char *ident = nullptr)
   {
@@ -122,10 +158,166 @@ namespace test_assign {
     REQUIRE( equals0(M2, _Values<TestType>{1, 2, 3, 4, 5, 6, 0, 0, 0}) );
   }
 
+  TEMPLATE_TEST_CASE("cs::Array<> aliased assignment.", "[assign][alias]", float, double) {
+    using Matrix = _Matrix<TestType>;
+    using Vector = _Vector<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    static_assert(!cs::if_reordering_v<decltype(Matrix() + 2*Matrix())>);
+    static_assert( cs::if_reordering_v<decltype(Matrix() + cs::transpose(Matrix()))>);
+
+    Matrix M{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    M = cs::transpose(M);
+    REQUIRE( equals0(M, _Values<TestType>{1, 4, 7, 2, 5, 8, 3, 6, 9}) );
+
+    M = cs::transpose(M);
+    M = M*M;
+    REQUIRE( equals0(M, _Values<TestType>{30, 36, 42, 66, 81, 96, 102, 126, 150}) );
+
+    M = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    M += M*M;
+    REQUIRE( equals0(M, _Values<TestType>{31, 38, 45, 70, 86, 102, 109, 134, 159}) );
+
+    const Matrix A{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    M.noalias() = A*A;
+    REQUIRE( equals0(M, _Values<TestType>{30, 36, 42, 66, 81, 96, 102, 126, 150}) );
+
+    M.noalias() -= A*A;
+    REQUIRE( equals0(M, _Values<TestType>{0, 0, 0, 0, 0, 0, 0, 0, 0}) );
+
+    Vector v{1, 2, 3};
+    const Vector w{3, 2, 1};
+    v = cs::cross(v, w);
+    REQUIRE( equals0(v, _Values<TestType>{-4, 8, -4}) );
+
+    TestType buffer[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    cs::NumericArrayMap<TestType,3,3> B(buffer);
+    B = cs::transpose(B);
+    REQUIRE( equals0(B, _Values<TestType>{1, 4, 7, 2, 5, 8, 3, 6, 9}) );
+  }
+
 } // namespace test_assign
 
 
 
+namespace test_batch {
+
+  TEMPLATE_TEST_CASE("cs::ArrayBatch<> functions.", "[batch][function]", float, double) {
+    using Vector = _Vector<TestType>;
+    using Traits = typename Vector::traits_type;
+    using  Batch = cs::ArrayBatch<Traits,11>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    Batch a, b;
+    for(std::size_t n = 0; n < a.size(); n++) {
+      const TestType s = static_cast<TestType>(n);
+      a.set(n, Vector{1 + s, 2, 3 - s});
+      b.set(n, Vector{s, 1, 2*s});
+    }
+    REQUIRE( equals0(a.get(4), _Values<TestType>{5, 2, -1}) );
+
+    const Batch c = cs::cross(a, b);
+    const Batch u = cs::normalize(a);
+    const auto  d = cs::dot(a, b);
+    const auto  l = cs::length(a);
+
+    bool ok = true;
+    for(std::size_t n = 0; n < a.size(); n++) {
+      const Vector x = a.get(n);
+      const Vector y = b.get(n);
+      const Vector z = cs::cross(x, y);
+      const Vector w = cs::normalize(x);
+      ok = ok  &&  equals0(c.get(n), {z(0, 0), z(1, 0), z(2, 0)});
+      ok = ok  &&  equals(u.get(n), {w(0, 0), w(1, 0), w(2, 0)}, FloatInfo<TestType>::epsilon0);
+      ok = ok  &&  d.get(n)(0, 0) == cs::dot(x, y);
+      ok = ok  &&  equals(l.get(n)(0, 0), cs::length(x), FloatInfo<TestType>::epsilon0);
+    }
+    REQUIRE( ok );
+
+    // NOTE: Far beyond the stack's capacity.
+    using Large = cs::ArrayBatch<Traits,1 << 20>;
+
+    const Large p(1);
+    const auto  q = cs::dot(cs::cross(p, p), p);
+    REQUIRE( (q.get(0)(0, 0) == 0  &&  q.get(q.size() - 1)(0, 0) == 0) );
+    REQUIRE( cs::dot(p, p).get(12345)(0, 0) == TestType{3} );
+
+    Large r(2);
+    const Large s(std::move(r));
+    r = p;
+    REQUIRE( (r.get(0)(2, 0) == 1  &&  s.get(s.size() - 1)(2, 0) == 2) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::ArrayBatch<> cholesky().", "[batch][cholesky]", float, double) {
+    using Matrix = cs::NumericArray<TestType,6,6>;
+    using Vector = cs::NumericArray<TestType,6,1>;
+    using  Batch = cs::ArrayBatch<typename Matrix::traits_type,7>;
+    using VBatch = cs::ArrayBatch<typename Vector::traits_type,7>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    Batch  A;
+    VBatch b;
+    for(std::size_t n = 0; n < A.size(); n++) {
+      const TestType s = static_cast<TestType>(n);
+      A.set(n, impl::createSPD<TestType,6>(s));
+      b.set(n, Vector{1, 2, 3, 4, 5, s});
+    }
+
+    const Batch  L = cs::cholesky(A);
+    const VBatch x = cs::choleskySolve(L, b);
+
+    bool ok = true;
+    for(std::size_t n = 0; n < A.size(); n++) {
+      const auto chol = cs::cholesky(A.get(n));
+      const Matrix Ln = chol.matrixL();
+      const Vector xn = chol.solve(b.get(n));
+
+      const Matrix R = L.get(n) - Ln;
+      const Vector r = x.get(n) - xn;
+      ok = ok  &&  cs::normInf(R) <= eps  &&  cs::normInf(r) <= eps;
+    }
+    REQUIRE( ok );
+  }
+
+  TEMPLATE_TEST_CASE("cs::ArrayBatch<> eigenSymmetric3x3().", "[batch][eigen]", float, double) {
+    using Matrix = _Matrix<TestType>;
+    using Vector = _Vector<TestType>;
+    using  Batch = cs::ArrayBatch<typename Matrix::traits_type,9>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    Batch A;
+    for(std::size_t n = 0; n < A.size(); n++) {
+      const TestType s = static_cast<TestType>(n);
+      A.set(n, Matrix{4 + s, 1, -s/4, 1, 2, s/2, -s/4, s/2, 3});
+    }
+    A.set(8, Matrix{2, 1, 1, 1, 2, 1, 1, 1, 2});
+
+    const auto [w, V] = cs::eigenSymmetric3x3(A);
+
+    bool ok = true;
+    for(std::size_t n = 0; n < A.size(); n++) {
+      const Vector wn = w.get(n);
+      const Vector en = cs::eigenSymmetric3x3(A.get(n)).eigenvalues();
+      const Vector  r = wn - en;
+      ok = ok  &&  cs::normInf(r) <= eps*8;
+      ok = ok  &&  impl::eigenResidual(A.get(n), wn, V.get(n)) <= eps*8;
+      ok = ok  &&  csAbs(cs::determinant(V.get(n)) - 1) <= eps*8;
+    }
+    REQUIRE( ok );
+  }
+
+} // namespace test_batch
+
+
+
 namespace test_binary {
 
   TEMPLATE_TEST_CASE("cs::Array<> all binary operations.", "[binary][all]", float, double) {
@@ -236,10 +428,326 @@ namespace test_binary {
     REQUIRE( equals0(y2, _Values<TestType>{2, 6, 12}) );
   }
 
+  TEMPLATE_TEST_CASE("cs::Array<> binary fused multiply-add.", "[binary][fma]", float, double) {
+    using Matrix = cs::NumericArray<TestType,4,4>;
+    using Vector = _Vector<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const Vector a{1, 2, 3};
+    const Vector b{2, 3, 4};
+    const TestType s{2};
+
+    const Vector y1 = a%b + a;
+    REQUIRE( equals0(y1, _Values<TestType>{3, 8, 15}) );
+
+    const Vector y2 = b + a%b;
+    REQUIRE( equals0(y2, _Values<TestType>{4, 9, 16}) );
+
+    const Vector y3 = s*a + b;
+    REQUIRE( equals0(y3, _Values<TestType>{4, 7, 10}) );
+
+    const Vector y4 = b + a*s;
+    REQUIRE( equals0(y4, _Values<TestType>{4, 7, 10}) );
+
+    const Matrix X{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    const Matrix Y = X%X + X*s;
+    REQUIRE( equals0(Y, _Values<TestType>{3, 8, 15, 24, 35, 48, 63, 80, 99, 120, 143, 168, 195, 224, 255, 288}) );
+  }
+
 } // namespace test_binary
 
 
 
+namespace test_cholesky {
+
+  TEMPLATE_TEST_CASE("cs::Cholesky<> decomposition.", "[cholesky][decompose]", float, double) {
+    using Matrix = cs::NumericArray<TestType,6,6>;
+    using Vector = cs::NumericArray<TestType,6,1>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix A = impl::createSPD<TestType,6>();
+
+    const auto chol = cs::cholesky(A);
+    REQUIRE( chol.isPositiveDefinite() );
+
+    const Matrix L = chol.matrixL();
+    REQUIRE( L(0, 1) == TestType{0} );
+
+    const Matrix R = L*cs::transpose(L) - A;
+    REQUIRE( cs::normInf(R) <= eps );
+
+    const Vector x{1, -2, 3, -4, 5, -6};
+    const Vector b = A*x;
+    const Vector y = chol.solve(b);
+    REQUIRE( equals(y, _Values<TestType>{1, -2, 3, -4, 5, -6}, eps) );
+
+    REQUIRE( equals(chol.determinant()/cs::determinant(A), TestType{1}, eps) );
+
+    const Matrix B = impl::createSPD<TestType,6>(TestType{-16});
+    REQUIRE( !cs::cholesky(B).isPositiveDefinite() );
+  }
+
+  TEMPLATE_TEST_CASE("cs::LDLT<> decomposition.", "[cholesky][ldlt]", float, double) {
+    using Matrix = cs::NumericArray<TestType,6,6>;
+    using Vector = cs::NumericArray<TestType,6,1>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix A = impl::createSPD<TestType,6>();
+
+    const auto ldlt = cs::ldlt(A);
+
+    const Matrix L = ldlt.matrixL();
+    const Vector d = ldlt.vectorD();
+    Matrix D;
+    for(std::size_t i = 0; i < D.rows(); i++) {
+      D(i, i) = d(i, 0);
+    }
+
+    const Matrix R = L*D*cs::transpose(L) - A;
+    REQUIRE( cs::normInf(R) <= eps );
+
+    const Vector x{1, -2, 3, -4, 5, -6};
+    const Vector b = A*x;
+    const Vector y = ldlt.solve(b);
+    REQUIRE( equals(y, _Values<TestType>{1, -2, 3, -4, 5, -6}, eps) );
+
+    REQUIRE( equals(ldlt.determinant()/cs::determinant(A), TestType{1}, eps) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::Cholesky<> rank-1 update and downdate.", "[cholesky][update]", float, double) {
+    using Matrix = cs::NumericArray<TestType,6,6>;
+    using Vector = cs::NumericArray<TestType,6,1>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix A = impl::createSPD<TestType,6>();
+    const Vector x{1, 2, -1, 0, 3, 1};
+    const Matrix Ax = A + x*cs::transpose(x);
+
+    auto chol = cs::cholesky(A);
+    chol.update(x);
+    const Matrix R1 = chol.matrixL() - cs::cholesky(Ax).matrixL();
+    REQUIRE( cs::normInf(R1) <= eps );
+
+    chol.downdate(x);
+    REQUIRE( chol.isPositiveDefinite() );
+    const Matrix R2 = chol.matrixL() - cs::cholesky(A).matrixL();
+    REQUIRE( cs::normInf(R2) <= eps );
+
+    auto ldlt = cs::ldlt(A);
+    ldlt.update(x);
+    const Matrix R3 = ldlt.matrixL() - cs::ldlt(Ax).matrixL();
+    const Vector r3 = ldlt.vectorD() - cs::ldlt(Ax).vectorD();
+    REQUIRE( (cs::normInf(R3) <= eps  &&  cs::normInf(r3) <= eps) );
+
+    ldlt.downdate(x);
+    const Matrix R4 = ldlt.matrixL() - cs::ldlt(A).matrixL();
+    const Vector r4 = ldlt.vectorD() - cs::ldlt(A).vectorD();
+    REQUIRE( (cs::normInf(R4) <= eps  &&  cs::normInf(r4) <= eps) );
+  }
+
+} // namespace test_cholesky
+
+
+
+namespace test_dynamic {
+
+  TEMPLATE_TEST_CASE("cs::DynamicArray<> assignment.", "[dynamic][assign]", float, double) {
+    using Array = cs::DynamicArray<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    Array a(37, 2);
+    REQUIRE( a.size() == 37 );
+    REQUIRE( reinterpret_cast<std::uintptr_t>(a.data())%Array::Alignment == 0 );
+    REQUIRE( std::all_of(a.data(), a.data() + a.size(), [](const TestType x) { return x == 2; }) );
+
+    const Array b = a;
+    REQUIRE( b.size() == 37 );
+    REQUIRE( b[36] == TestType{2} );
+
+    Array c = std::move(a);
+    REQUIRE( c.size() == 37 );
+    REQUIRE( a.size() == 0 );
+
+    c.resize(40);
+    REQUIRE( c.size() == 40 );
+    REQUIRE( c[36] == TestType{2} );
+    REQUIRE( c[39] == TestType{0} );
+
+    c = {1, 2, 3};
+    REQUIRE( c.size() == 3 );
+    REQUIRE( (c[0] == 1  &&  c[1] == 2  &&  c[2] == 3) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::DynamicArray<> expressions.", "[dynamic][expr]", float, double) {
+    using Array = cs::DynamicArray<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    constexpr std::size_t COUNT = 1001;
+
+    Array a(COUNT), b(COUNT);
+    for(std::size_t l = 0; l < COUNT; l++) {
+      a[l] = static_cast<TestType>(l%7);
+      b[l] = static_cast<TestType>(l%5) - 2;
+    }
+
+    Array y(COUNT);
+    const auto check = [&](const auto& f) -> bool {
+      for(std::size_t l = 0; l < COUNT; l++) {
+        if( y[l] != f(a[l], b[l]) ) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    y = a + b;
+    REQUIRE( check([](const TestType x, const TestType z) { return x + z; }) );
+
+    y = a - b;
+    REQUIRE( check([](const TestType x, const TestType z) { return x - z; }) );
+
+    y = a%b + a;
+    REQUIRE( check([](const TestType x, const TestType z) { return x*z + x; }) );
+
+    y = 2*a - b/2;
+    REQUIRE( check([](const TestType x, const TestType z) { return 2*x - z/2; }) );
+
+    y = cs::clamp(b, -1, 1);
+    REQUIRE( check([](const TestType, const TestType z) { return std::clamp<TestType>(z, -1, 1); }) );
+
+    y = cs::max(-b, 0);
+    REQUIRE( check([](const TestType, const TestType z) { return std::max<TestType>(-z, 0); }) );
+
+    y = cs::min(a, 3);
+    REQUIRE( check([](const TestType x, const TestType) { return std::min<TestType>(x, 3); }) );
+
+    y = a;
+    y += b;
+    y *= 2;
+    REQUIRE( check([](const TestType x, const TestType z) { return 2*(x + z); }) );
+
+    const Array z(a + a);
+    REQUIRE( z.size() == COUNT );
+    bool ok = true;
+    TestType sum = 0;
+    for(std::size_t l = 0; l < COUNT; l++) {
+      ok = ok  &&  z[l] == 2*a[l];
+      sum += a[l]*b[l];
+    }
+    REQUIRE( ok );
+    REQUIRE( cs::dot(a, b) == sum );
+  }
+
+  TEMPLATE_TEST_CASE("cs::DynamicArray<> expression size.", "[dynamic][size]", float, double) {
+    using Array = cs::DynamicArray<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const Array a{1, 2, 3, 4}, b{4, 3, 2, 1};
+
+    Array e;
+    e = a + b;
+    REQUIRE( e.size() == 4 );
+    REQUIRE( std::all_of(e.data(), e.data() + e.size(), [](const TestType x) { return x == 5; }) );
+
+    Array d(1000, 7);
+    d = a - b;
+    REQUIRE( d.size() == 4 );
+    REQUIRE( (d[0] == -3  &&  d[1] == -1  &&  d[2] == 1  &&  d[3] == 3) );
+
+    const Array c(2*b);
+    REQUIRE( c.size() == 4 );
+    REQUIRE( (c[0] == 8  &&  c[3] == 2) );
+
+    Array f(a);
+    f += b;
+    REQUIRE( f.size() == 4 );
+    REQUIRE( f[2] == 5 );
+  }
+
+} // namespace test_dynamic
+
+
+
+namespace test_eigen {
+
+  TEMPLATE_TEST_CASE("cs::EigenSymmetric3x3<> closed form.", "[eigen][analytic]", float, double) {
+    using Matrix = _Matrix<TestType>;
+    using Vector = _Vector<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix A{2, 1, 0, 1, 2, 1, 0, 1, 2};
+
+    const auto eigen = cs::eigenSymmetric3x3(A);
+    const Vector w = eigen.eigenvalues();
+    const Matrix V = eigen.eigenvectors();
+
+    const TestType sqrt2 = csSqrt(TestType{2});
+    REQUIRE( equals(w, {2 - sqrt2, 2, 2 + sqrt2}, eps) );
+    REQUIRE( impl::eigenResidual(A, w, V) <= eps );
+    REQUIRE( equals(cs::determinant(V), TestType{1}, eps) );
+
+    const Matrix D{3, 0, 0, 0, 1, 0, 0, 0, 2};
+    const auto diag = cs::eigenSymmetric3x3(D);
+    REQUIRE( equals0(diag.eigenvalues(), _Values<TestType>{1, 2, 3}) );
+    REQUIRE( equals0(diag.eigenvectors(), _Values<TestType>{0, 0, 1, 1, 0, 0, 0, 1, 0}) );
+
+    // NOTE: Sorting requires an odd number of swaps.
+    const Matrix E{2, 0, 0, 0, 1, 0, 0, 0, 3};
+    const auto odd = cs::eigenSymmetric3x3(E);
+    REQUIRE( equals0(odd.eigenvalues(), _Values<TestType>{1, 2, 3}) );
+    REQUIRE( impl::eigenResidual(E, odd.eigenvalues(), odd.eigenvectors()) <= eps );
+    REQUIRE( cs::determinant(odd.eigenvectors()) == TestType{1} );
+  }
+
+  TEMPLATE_TEST_CASE("cs::EigenSymmetric3x3<> degenerate eigenvalues.", "[eigen][jacobi]", float, double) {
+    using Matrix = _Matrix<TestType>;
+    using Vector = _Vector<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix A{2, 1, 1, 1, 2, 1, 1, 1, 2};
+
+    const auto eigen = cs::eigenSymmetric3x3(A);
+    const Vector w = eigen.eigenvalues();
+    const Matrix V = eigen.eigenvectors();
+
+    REQUIRE( equals(w, _Values<TestType>{1, 1, 4}, eps) );
+    REQUIRE( impl::eigenResidual(A, w, V) <= eps );
+    REQUIRE( equals(cs::determinant(V), TestType{1}, eps) );
+
+    const Matrix J{1, 1, 1, 1, 1, 1, 1, 1, 1};
+    const auto ones = cs::eigenSymmetric3x3(J);
+    REQUIRE( equals(ones.eigenvalues(), _Values<TestType>{0, 0, 3}, eps) );
+    REQUIRE( impl::eigenResidual(J, ones.eigenvalues(), ones.eigenvectors()) <= eps );
+    REQUIRE( equals(cs::determinant(ones.eigenvectors()), TestType{1}, eps) );
+
+    const Matrix B = A*TestType{1e-3};
+    const auto small = cs::eigenSymmetric3x3(B);
+    REQUIRE( impl::eigenResidual(B, small.eigenvalues(), small.eigenvectors()) <= eps );
+  }
+
+} // namespace test_eigen
+
+
+
 namespace test_function {
 
   template<typename value_T, std::size_t ROWS, std::size_t COLS>
@@ -351,6 +859,39 @@ namespace test_function {
                     FloatInfo<TestType>::epsilon0) );
   }
 
+  TEMPLATE_TEST_CASE("cs::Array<> function inverse() of 2x2 and 4x4 matrices.", "[function][inverse]", float, double) {
+    using Matrix2 = cs::NumericArray<TestType,2,2>;
+    using Matrix4 = cs::NumericArray<TestType,4,4>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    Matrix2 M2{4, 7, 2, 6};
+    REQUIRE( equals(cs::determinant(M2), TestType{10}, eps) );
+
+    M2 = cs::inverse(M2);
+    REQUIRE( equals(M2, _Values<TestType>{.6, -.7, -.2, .4}, eps) );
+
+    const Matrix4 I4 = cs::identity<typename Matrix4::traits_type>();
+
+    const Matrix4 A{0, 2, 1, 4, 1, 1, 0, 2, 2, 0, 3, 1, 1, 3, 2, 0};
+
+    const auto lu = cs::lu(A);
+    REQUIRE( equals(cs::determinant(A), lu.determinant(), eps) );
+
+    const Matrix4 Ainv = cs::inverse(A);
+    const Matrix4 R = Ainv - lu.inverse();
+    REQUIRE( cs::normInf(R) <= eps );
+
+    // NOTE: All diagonal blocks are singular.
+    const Matrix4 P{0, 0, 1, 0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 4, 0, 0};
+    REQUIRE( equals(cs::determinant(P), TestType{24}, eps) );
+
+    const Matrix4 E = P*cs::inverse(P) - I4;
+    REQUIRE( cs::normInf(E) <= eps );
+  }
+
   TEMPLATE_TEST_CASE("cs::Array<> function length().", "[function][length]", float, double) {
     using Vector = _Vector<TestType>;
 
@@ -396,6 +937,57 @@ namespace test_function {
     const Vector y = cs::normalize(x);
     REQUIRE( equals(y, _Values<TestType>{.333333333, .666666666, .666666666},
                     FloatInfo<TestType>::epsilon0) );
+
+    const auto expr = cs::normalize(x + x - cs::eval(x));
+    const Vector z = expr;
+    REQUIRE( equals(z, _Values<TestType>{.333333333, .666666666, .666666666},
+                    FloatInfo<TestType>::epsilon0) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::Array<> function reductions.", "[function][reduce]", float, double) {
+    using Matrix55 = cs::NumericArray<TestType,5,5>;
+    using   Vector = _Vector<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const Vector x{-3, -1, -2};
+
+    REQUIRE( cs::sum(x) == TestType{-6} );
+    REQUIRE( cs::minCoeff(x) == TestType{-3} );
+    REQUIRE( cs::maxCoeff(x) == TestType{-1} );
+    REQUIRE( cs::normL1(x) == TestType{6} );
+    REQUIRE( cs::normInf(x) == TestType{3} );
+    REQUIRE( cs::squaredNorm(x) == TestType{14} );
+
+    // NOTE: Padding lanes of the expression evaluate to 1, too.
+    REQUIRE( cs::sum(cs::max(x, TestType{1})) == TestType{3} );
+    REQUIRE( cs::minCoeff(-x) == TestType{1} );
+
+    Matrix55 M;
+    for(std::size_t l = 0; l < M.size(); l++) {
+      M[l] = TestType(l) - TestType{20};
+    }
+
+    REQUIRE( cs::sum(M) == TestType{-200} );
+    REQUIRE( cs::minCoeff(M) == TestType{-20} );
+    REQUIRE( cs::maxCoeff(M) == TestType{4} );
+    REQUIRE( cs::normL1(M) == TestType{220} );
+    REQUIRE( cs::normInf(M + M) == TestType{40} );
+    REQUIRE( cs::squaredNorm(M) == TestType{2900} );
+
+    // NOTE: Operands of mixed storage order pair their elements by (i,j).
+    using    Traits = cs::ArrayTraits<TestType,4,4>;
+    using RowMatrix = cs::Array<cs::NoManipulator<cs::RowMajorPolicy<Traits>>>;
+    using ColMatrix = cs::Array<cs::NoManipulator<cs::ColumnMajorPolicy<Traits>>>;
+
+    const RowMatrix R{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    const ColMatrix C{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+    REQUIRE( cs::maxCoeff(R - C) == TestType{0} );
+    REQUIRE( cs::minCoeff(R - C) == TestType{0} );
+    REQUIRE( cs::normL1(R - C) == TestType{0} );
+    REQUIRE( cs::sum(R + C) == TestType{272} );
+    REQUIRE( cs::maxCoeff(C - C) == TestType{0} );
   }
 
   TEMPLATE_TEST_CASE("cs::Array<> function transpose().", "[function][transpose]", float, double) {
@@ -498,6 +1090,160 @@ namespace test_geometry {
 
 
 
+namespace test_kernels {
+
+  TEMPLATE_TEST_CASE("cs::kernels runtime dispatch.", "[kernels][dispatch]", float, double) {
+    constexpr std::size_t COUNT = 37;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    REQUIRE( cs::dispatchISA() <= cs::cpuISA() );
+
+    for(const cs::ISA isa : {cs::ISA::SSE2, cs::ISA::AVX2, cs::ISA::AVX512}) {
+      if( isa > cs::cpuISA() ) {
+        continue;
+      }
+      std::cout << "ISA: " << cs::isaName(isa) << std::endl;
+
+      const cs::KernelTable<TestType> kernels = cs::kernels::table<TestType>(isa);
+
+      TestType x[COUNT + 1], y[COUNT + 1];
+      y[COUNT] = 0;
+
+      kernels.assign(x, 2, COUNT);
+      kernels.copy(y + 1, x, COUNT - 1);
+      y[0] = 1;
+
+      TestType sum{0};
+      for(std::size_t l = 0; l < COUNT; l++) {
+        sum += y[l];
+      }
+      REQUIRE( sum == TestType{2*COUNT - 1} );
+      REQUIRE( y[COUNT] == TestType{0} );
+
+      REQUIRE( kernels.dot(x, y, COUNT) == TestType{4*COUNT - 2} );
+    }
+
+    TestType a[COUNT];
+    cs::kernels::assign(a, TestType{1}, COUNT);
+    REQUIRE( cs::kernels::dot(a, a, COUNT) == TestType{COUNT} );
+  }
+
+} // namespace test_kernels
+
+
+
+namespace test_lu {
+
+  TEMPLATE_TEST_CASE("cs::LU<> decomposition with pivoting.", "[lu][decompose]", float, double) {
+    using Matrix = cs::NumericArray<TestType,4,4>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix A{0, 2, 1, 4, 1, 1, 0, 2, 2, 0, 3, 1, 1, 3, 2, 0};
+
+    const auto lu = cs::lu(A);
+    REQUIRE( lu.permutation(0) == 2 );
+
+    Matrix PA;
+    for(std::size_t i = 0; i < PA.rows(); i++) {
+      for(std::size_t j = 0; j < PA.columns(); j++) {
+        PA(i, j) = A(lu.permutation(i), j);
+      }
+    }
+    const Matrix R = lu.matrixL()*lu.matrixU() - PA;
+    REQUIRE( cs::normInf(R) <= eps );
+
+    REQUIRE( equals(lu.determinant(), TestType{50}, eps) );
+    REQUIRE( equals(cs::determinant(A), TestType{50}, eps) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::LU<> determinant of 3x3 matrix.", "[lu][determinant]", float, double) {
+    using Matrix = _Matrix<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const Matrix M{3, 1, 1, 5, 2, 1, 3, 1, 2};
+
+    REQUIRE( equals(cs::lu(M).determinant(), cs::determinant(M), FloatInfo<TestType>::epsilon0) );
+
+    const Matrix S{1, 2, 3, 2, 4, 6, 1, 1, 1};
+    REQUIRE( cs::lu(S).determinant() == TestType{0} );
+  }
+
+  TEMPLATE_TEST_CASE("cs::LU<> inverse of 5x5 matrix.", "[lu][inverse]", float, double) {
+    using Matrix = cs::NumericArray<TestType,5,5>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix B{
+      4, 1, 0, 0, 1,
+      1, 5, 2, 0, 0,
+      0, 2, 6, 1, 0,
+      0, 0, 1, 7, 3,
+      1, 0, 0, 3, 8
+    };
+
+    const Matrix Binv = cs::inverse(B);
+
+    Matrix I;
+    for(std::size_t i = 0; i < I.rows(); i++) {
+      I(i, i) = 1;
+    }
+    const Matrix R = B*Binv - I;
+    REQUIRE( cs::normInf(R) <= eps );
+
+    REQUIRE( equals(cs::determinant(B)/TestType{4289}, TestType{1}, eps) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::LU<> solve linear systems.", "[lu][solve]", float, double) {
+    using Matrix   = cs::NumericArray<TestType,4,4>;
+    using Matrix42 = cs::NumericArray<TestType,4,2>;
+    using Matrix8  = cs::NumericArray<TestType,8,8>;
+    using Vector   = cs::NumericArray<TestType,4,1>;
+    using Vector8  = cs::NumericArray<TestType,8,1>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix A{0, 2, 1, 4, 1, 1, 0, 2, 2, 0, 3, 1, 1, 3, 2, 0};
+    const Vector b{23, 11, 15, 13};
+
+    const Vector x = cs::solve(A, b);
+    REQUIRE( equals(x, _Values<TestType>{1, 2, 3, 4}, eps) );
+
+    const Matrix42 X{1, -1, 2, 0, 3, 1, 4, -2};
+    const Matrix42 B = A*X;
+
+    const Matrix42 Y = cs::solve(A, B);
+    REQUIRE( equals(Y, _Values<TestType>{1, -1, 2, 0, 3, 1, 4, -2}, eps) );
+
+    Matrix8 A8;
+    Vector8 x8;
+    for(std::size_t i = 0; i < A8.rows(); i++) {
+      for(std::size_t j = 0; j < A8.columns(); j++) {
+        A8(i, j) = i == j
+            ? TestType{10}
+            : TestType((i + 2*j)%5) - TestType{2};
+      }
+      x8(i, 0) = TestType(i + 1);
+    }
+    const Vector8 b8 = A8*x8;
+
+    const Vector8 y8 = cs::solve(A8, b8);
+    const Vector8 R = y8 - x8;
+    REQUIRE( cs::normInf(R) <= eps );
+  }
+
+} // namespace test_lu
+
+
+
 namespace test_manipulator {
 
   template<typename policy_T>
@@ -509,27 +1255,20 @@ namespace test_manipulator {
 
     static_assert(cs::if_dimensions_v<traits_type,2,3>);
 
-    Matrix23Manip(value_type *data) noexcept
-      : m00(data)
-      , m01(data)
-      , m02(data)
-      , m10(data)
-      , m11(data)
-      , m12(data)
-    {
-    }
+    Matrix23Manip() noexcept = default;
 
     ~Matrix23Manip() noexcept = default;
 
-    cs::ArrayProperty<policy_type,0,0> m00;
-    cs::ArrayProperty<policy_type,0,1> m01;
-    cs::ArrayProperty<policy_type,0,2> m02;
-    cs::ArrayProperty<policy_type,1,0> m10;
-    cs::ArrayProperty<policy_type,1,1> m11;
-    cs::ArrayProperty<policy_type,1,2> m12;
+    union {
+      value_type _data[cs::impl::ArrayStorage<traits_type>::DataSize];
 
-  private:
-    Matrix23Manip() noexcept = delete;
+      cs::ArrayProperty<policy_type,0,0> m00;
+      cs::ArrayProperty<policy_type,0,1> m01;
+      cs::ArrayProperty<policy_type,0,2> m02;
+      cs::ArrayProperty<policy_type,1,0> m10;
+      cs::ArrayProperty<policy_type,1,1> m11;
+      cs::ArrayProperty<policy_type,1,2> m12;
+    };
   };
 
   TEMPLATE_TEST_CASE("cs::Array<> with cs::ArrayProperty<> manipulator.", "[manipulator][property]", float, double) {
@@ -562,10 +1301,375 @@ namespace test_manipulator {
     REQUIRE( equals(c, _Values<TestType>{0.25, 0.5, 1}, 0.0025) );
   }
 
+  TEMPLATE_TEST_CASE("cs::Array<> is trivially copyable.", "[manipulator][trivial]", float, double) {
+    using Matrix = _Matrix<TestType>;
+    using  Color = _Color<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    static_assert(std::is_trivially_copyable_v<Matrix>);
+    static_assert(std::is_trivially_copyable_v<Color>);
+    static_assert(sizeof(Color) == sizeof(cs::NumericArray<TestType,3,1>));
+
+    const Matrix A{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    Matrix B;
+    std::memcpy(&B, &A, sizeof(Matrix));
+    REQUIRE( equals0(B, _Values<TestType>{1, 2, 3, 4, 5, 6, 7, 8, 9}) );
+
+    Color c, d;
+    c.r = 0xFF;
+    std::memcpy(&d, &c, sizeof(Color));
+    d.g = 0xFF;
+    REQUIRE( (c.r == 0xFF  &&  c.g == 0  &&  d.r == 0xFF  &&  d.g == 0xFF) );
+  }
+
 } // namespace test_manipulator
 
 
 
+namespace test_map {
+
+  TEMPLATE_TEST_CASE("cs::ArrayMap<> over unaligned memory.", "[map][unaligned]", float, double) {
+    using Matrix = _Matrix<TestType>;
+    using    Map = cs::NumericArrayMap<TestType,3,3>;
+    using   View = cs::NumericArrayView<TestType,3,3>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    TestType buffer[1 + 9 + 9 + 1];
+    for(std::size_t l = 0; l < 20; l++) {
+      buffer[l] = static_cast<TestType>(l);
+    }
+
+    const View A(buffer + 1);
+    REQUIRE( equals0(A, _Values<TestType>{1, 2, 3, 4, 5, 6, 7, 8, 9}) );
+
+    const Matrix M = A + A;
+    REQUIRE( equals0(M, _Values<TestType>{2, 4, 6, 8, 10, 12, 14, 16, 18}) );
+
+    Map B(buffer + 10);
+    B = 2*A - M + A;
+    REQUIRE( equals0(B, _Values<TestType>{1, 2, 3, 4, 5, 6, 7, 8, 9}) );
+    REQUIRE( buffer[19] == TestType{19} );
+
+    B = TestType{-1};
+    REQUIRE( equals0(B, _Values<TestType>{-1, -1, -1, -1, -1, -1, -1, -1, -1}) );
+    REQUIRE( (buffer[9] == TestType{9}  &&  buffer[19] == TestType{19}) );
+
+    B = cs::transpose(A);
+    B += A;
+    B *= 2;
+    REQUIRE( equals0(B, _Values<TestType>{4, 12, 20, 12, 20, 28, 20, 28, 36}) );
+    REQUIRE( buffer[19] == TestType{19} );
+
+    Map C(buffer + 1);
+    C = B;
+    REQUIRE( equals0(A, _Values<TestType>{4, 12, 20, 12, 20, 28, 20, 28, 36}) );
+    REQUIRE( buffer[0] == TestType{0} );
+  }
+
+} // namespace test_map
+
+
+
+namespace test_qr {
+
+  TEMPLATE_TEST_CASE("cs::QR<> decomposition and determinant.", "[qr][decompose]", float, double) {
+    using Matrix = cs::NumericArray<TestType,4,4>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix A{0, 2, 1, 4, 1, 1, 0, 2, 2, 0, 3, 1, 1, 3, 2, 0};
+
+    const auto qr = cs::qr(A);
+    const Matrix Q = qr.matrixQ();
+    const Matrix R = qr.matrixR();
+
+    const Matrix E = Q*R - A;
+    REQUIRE( cs::normInf(E) <= eps );
+
+    const Matrix I = cs::transpose(Q)*Q - cs::identity<typename Matrix::traits_type>();
+    REQUIRE( cs::normInf(I) <= eps );
+
+    REQUIRE( equals(qr.determinant(), cs::determinant(A), eps) );
+    REQUIRE( equals(cs::qr(impl::create<TestType>()).determinant(), TestType{0}, eps) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::QR<> least-squares solution.", "[qr][solve]", float, double) {
+    using Matrix   = cs::NumericArray<TestType,5,5>;
+    using Matrix83 = cs::NumericArray<TestType,8,3>;
+    using Vector3  = cs::NumericArray<TestType,3,1>;
+    using Vector8  = cs::NumericArray<TestType,8,1>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    // Plane z = 2*x - 3*y + 1 through 8 points
+    Matrix83 A;
+    Vector8  z;
+    for(std::size_t i = 0; i < A.rows(); i++) {
+      const TestType x = TestType(i%3);
+      const TestType y = TestType(i/3) - TestType(i%2);
+      A(i, 0) = x;
+      A(i, 1) = y;
+      A(i, 2) = 1;
+      z(i, 0) = 2*x - 3*y + 1;
+    }
+
+    const Vector3 c = cs::qr(A).solve(z);
+    REQUIRE( equals(c, _Values<TestType>{2, -3, 1}, eps) );
+
+    const Matrix B{
+      4, 1, 0, 0, 1,
+      1, 5, 2, 0, 0,
+      0, 2, 6, 1, 0,
+      0, 0, 1, 7, 3,
+      1, 0, 0, 3, 8
+    };
+
+    const Matrix Binv = cs::qr(B).solve(cs::identity<typename Matrix::traits_type>());
+    const Matrix R = Binv - cs::inverse(B);
+    REQUIRE( cs::normInf(R) <= eps );
+  }
+
+} // namespace test_qr
+
+
+
+namespace test_simd {
+
+  TEMPLATE_TEST_CASE("cs::SIMD<> horizontal addition.", "[simd][hadd]", float, double) {
+    using simd = cs::SIMD<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    alignas(simd::Alignment) TestType x[simd::ElementCount];
+    for(std::size_t i = 0; i < simd::ElementCount; i++) {
+      x[i] = static_cast<TestType>(i + 1);
+    }
+
+    const TestType y = simd::scalar(simd::hadd(simd::load(x)));
+    REQUIRE( y == static_cast<TestType>(simd::ElementCount*(simd::ElementCount + 1)/2) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::Array<> 4x4 block operations.", "[simd][block]", float, double) {
+    using Matrix = cs::NumericArray<TestType,4,4>;
+    using Vector = cs::NumericArray<TestType,4,1>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const Matrix A{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+    const Matrix B = 2*A - A%A;
+    REQUIRE( equals0(B, _Values<TestType>{1, 0, -3, -8, -15, -24, -35, -48,
+                                           -63, -80, -99, -120, -143, -168, -195, -224}) );
+
+    const Vector x{1, 2, 3, 4};
+    REQUIRE( cs::dot(x, x) == TestType{30} );
+  }
+
+  TEMPLATE_TEST_CASE("cs::Array<> block matrix multiplication.", "[simd][mul]", float, double) {
+    using Matrix4x4 = cs::NumericArray<TestType,4,4>;
+    using Matrix4x8 = cs::NumericArray<TestType,4,8>;
+    using Matrix8x8 = cs::NumericArray<TestType,8,8>;
+    using    policy = typename Matrix4x4::policy_type;
+    using      simd = cs::SIMD<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const Matrix4x4 A{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+    REQUIRE( cs::check_simd<decltype(A*A),policy>() == (4%simd::ElementCount == 0) );
+
+    const Matrix4x4 Y1 = A*A;
+    REQUIRE( equals0(Y1, _Values<TestType>{90, 100, 110, 120, 202, 228, 254, 280,
+                                            314, 356, 398, 440, 426, 484, 542, 600}) );
+
+    const Matrix4x4 Y2 = A*A + A;
+    REQUIRE( equals0(Y2, _Values<TestType>{91, 102, 113, 124, 207, 234, 261, 288,
+                                            323, 366, 409, 452, 439, 498, 557, 616}) );
+
+    Matrix4x8 B;
+    Matrix8x8 C;
+    for(std::size_t i = 0; i < 8; i++) {
+      for(std::size_t j = 0; j < 8; j++) {
+        if( i < 4 ) {
+          B(i, j) = static_cast<TestType>(i*8 + j);
+        }
+        C(i, j) = static_cast<TestType>(i == j ? 2 : 0) + static_cast<TestType>(j%2);
+      }
+    }
+
+    const Matrix4x8 Y3 = B*C;
+    for(std::size_t i = 0; i < 4; i++) {
+      for(std::size_t j = 0; j < 8; j++) {
+        TestType y = 0;
+        for(std::size_t k = 0; k < 8; k++) {
+          y += B(i, k)*C(k, j);
+        }
+        REQUIRE( Y3(i, j) == y );
+      }
+    }
+  }
+
+  TEMPLATE_TEST_CASE("cs::Array<> column-major storage order.", "[simd][policy]", float, double) {
+    using    Traits = cs::ArrayTraits<TestType,4,4>;
+    using  RowMajor = cs::RowMajorPolicy<Traits>;
+    using  ColMajor = cs::ColumnMajorPolicy<Traits>;
+    using RowMatrix = cs::Array<cs::NoManipulator<RowMajor>>;
+    using ColMatrix = cs::Array<cs::NoManipulator<ColMajor>>;
+    using   Matrix3 = cs::Array<cs::NoManipulator<cs::ColumnMajorPolicy<cs::ArrayTraits<TestType,3,3>>>>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const _Values<TestType> AA{90, 100, 110, 120, 202, 228, 254, 280,
+                               314, 356, 398, 440, 426, 484, 542, 600};
+
+    const RowMatrix R{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    const ColMatrix C{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    REQUIRE( C[1] == TestType{5} );
+    REQUIRE( C[4] == TestType{2} );
+
+    REQUIRE(  cs::check_simd<decltype(C + C),ColMajor>() );
+    REQUIRE( !cs::check_simd<decltype(C + C),RowMajor>() );
+    REQUIRE(  cs::check_simd<decltype(cs::transpose(C)),RowMajor>() );
+
+    const RowMatrix Y1 = C;
+    REQUIRE( equals0(Y1, _Values<TestType>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}) );
+
+    const RowMatrix Y2 = C + C;
+    REQUIRE( equals0(Y2, _Values<TestType>{2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32}) );
+
+    const RowMatrix Y3 = R + C;
+    REQUIRE( equals0(Y3, _Values<TestType>{2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32}) );
+
+    const RowMatrix Y4 = cs::transpose(C);
+    REQUIRE( equals0(Y4, _Values<TestType>{1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15, 4, 8, 12, 16}) );
+
+    const ColMatrix Y5 = C*C;
+    REQUIRE( equals0(Y5, AA) );
+
+    const RowMatrix Y6 = C*C;
+    REQUIRE( equals0(Y6, AA) );
+
+    const ColMatrix Y7 = R;
+    REQUIRE( equals0(Y7, _Values<TestType>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}) );
+
+    const Matrix3 M1{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    const _Matrix<TestType> M2 = M1 - 2*M1;
+    REQUIRE( equals0(M2, _Values<TestType>{-1, -2, -3, -4, -5, -6, -7, -8, -9}) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::Array<> partial tail block.", "[simd][tail]", float, double) {
+    using Matrix = _Matrix<TestType>;
+    using Vector = _Vector<TestType>;
+    using   simd = cs::SIMD<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    REQUIRE( sizeof(Matrix) == simd::size(9)*sizeof(TestType) );
+    REQUIRE( sizeof(Vector) == simd::size(3)*sizeof(TestType) );
+
+    Vector v[2] = {Vector{1, 2, 3}, Vector{4, 5, 6}};
+    v[0] = v[0] + v[0];
+    v[0] *= 2;
+    REQUIRE( equals0(v[0], _Values<TestType>{4, 8, 12}) );
+    REQUIRE( equals0(v[1], _Values<TestType>{4, 5, 6}) );
+
+    const Matrix M[2] = {Matrix{1, 2, 3, 4, 5, 6, 7, 8, 9}, Matrix(1)};
+    REQUIRE( equals0(M[0], _Values<TestType>{1, 2, 3, 4, 5, 6, 7, 8, 9}) );
+    REQUIRE( equals0(M[1], _Values<TestType>{1, 1, 1, 1, 1, 1, 1, 1, 1}) );
+    REQUIRE( cs::dot(v[1], v[1]) == TestType{77} );
+  }
+
+} // namespace test_simd
+
+
+
+namespace test_svd {
+
+  TEMPLATE_TEST_CASE("cs::SVD<> decomposition.", "[svd][decompose]", float, double) {
+    using Matrix   = cs::NumericArray<TestType,4,4>;
+    using Matrix64 = cs::NumericArray<TestType,6,4>;
+    using Vector   = cs::NumericArray<TestType,4,1>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    Matrix64 A;
+    for(std::size_t i = 0; i < A.rows(); i++) {
+      for(std::size_t j = 0; j < A.columns(); j++) {
+        A(i, j) = TestType((i*3 + j*5)%7) - TestType(j);
+      }
+    }
+
+    const auto svd = cs::svd(A);
+    const Matrix64 U = svd.matrixU();
+    const Matrix   V = svd.matrixV();
+    const Vector   s = svd.singularValues();
+
+    Matrix S;
+    for(std::size_t i = 0; i < S.rows(); i++) {
+      S(i, i) = s(i, 0);
+    }
+
+    const Matrix64 E = U*S*cs::transpose(V) - A;
+    REQUIRE( cs::normInf(E) <= eps*s(0, 0) );
+
+    const Matrix IU = cs::transpose(U)*U - cs::identity<typename Matrix::traits_type>();
+    const Matrix IV = cs::transpose(V)*V - cs::identity<typename Matrix::traits_type>();
+    REQUIRE( cs::normInf(IU) <= eps );
+    REQUIRE( cs::normInf(IV) <= eps );
+
+    REQUIRE( (s(0, 0) >= s(1, 0)  &&  s(1, 0) >= s(2, 0)  &&  s(2, 0) >= s(3, 0)) );
+    REQUIRE( svd.rank() == 4 );
+
+    const Matrix B{0, 2, 1, 4, 1, 1, 0, 2, 2, 0, 3, 1, 1, 3, 2, 0};
+
+    const Vector t = cs::svd(B).singularValues();
+    const TestType det = t(0, 0)*t(1, 0)*t(2, 0)*t(3, 0);
+    REQUIRE( equals(det, csAbs(cs::determinant(B)), eps) );
+  }
+
+  TEMPLATE_TEST_CASE("cs::SVD<> pseudo-inverse and rank.", "[svd][solve]", float, double) {
+    using Matrix = _Matrix<TestType>;
+
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const TestType eps = 64*FloatInfo<TestType>::epsilon0;
+
+    const Matrix M{3, 1, 1, 5, 2, 1, 3, 1, 2};
+
+    const Matrix Minv = cs::svd(M).solve(cs::identity<typename Matrix::traits_type>());
+    const Matrix R = Minv - cs::inverse(M);
+    REQUIRE( cs::normInf(R) <= eps );
+
+    const Matrix S{1, 2, 3, 2, 4, 6, 1, 1, 1};
+    REQUIRE( cs::svd(S).rank() == 2 );
+
+    // Procrustes: recover the rotation mapping points P onto Q
+    using Matrix43 = cs::NumericArray<TestType,4,3>;
+
+    const Matrix   R0 = cs::rotateZ<typename Matrix::traits_type>(TestType{0.5})*
+        cs::rotateX<typename Matrix::traits_type>(TestType{-0.25});
+    const Matrix43 P{1, 0, 0, 0, 2, 0, 0, 0, 3, 1, 1, 1};
+    const Matrix43 Q = P*cs::transpose(R0);
+
+    const auto svd = cs::svd(cs::transpose(P)*Q);
+    const Matrix Rk = svd.matrixV()*cs::transpose(svd.matrixU());
+    const Matrix Ek = Rk - R0;
+    REQUIRE( cs::normInf(Ek) <= eps );
+  }
+
+} // namespace test_svd
+
+
+
 namespace test_unary {
 
   TEMPLATE_TEST_CASE("cs::Array<> unary plus.", "[unary][plus]", float, double) {
@@ -1,9 +1,19 @@
+#include <cstring>
+
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include <catch.hpp>
 
+#include <N4/BVH.h>
+#include <N4/Kernels.h>
 #include <N4/N4.h>
 #include <N4/Optics.h>
+#include <N4/QBVH.h>
+#include <N4/Quaternion4f.h>
+#include <N4/RayPacket.h>
+#include <N4/Triangle.h>
 #include <N4/Util.h>
 
 ////// Global Types //////////////////////////////////////////////////////////
@@ -242,6 +252,9 @@ namespace test_n4 {
     REQUIRE( equals(a*2 - a  , {1, 2, 3, W0}                              , 0) );
     REQUIRE( equals(4*a/2 - a, {1, 2, 3, W0}                              , 0) );
     REQUIRE( equals(6/a,       {6, 3, 2, W0}                              , 0) );
+    REQUIRE( equals(a*b + a  , {3, 8, 15, W0}                             , 0) );
+    REQUIRE( equals(b + 2*a  , {4, 7, 10, W0}                             , 0) );
+    REQUIRE( equals(b + a*2  , {4, 7, 10, W0}                             , 0) );
     REQUIRE( equals(n4::translate(1, 1, 1)*a, {1 + W0, 2 + W0, 3 + W0, W0}, 0) );
   }
 
@@ -294,6 +307,23 @@ namespace test_n4 {
     n.z = 3;
 
     REQUIRE( equals(n4::expr_cast_assign_w<Vec4f::traits_type>(n), {1, 2, 3, 0}, 0) );
+
+    n4::Color3f c;
+    c.r8 = 0xFF;
+    c.g  = 0.5;
+    c.b += 0.25;
+
+    REQUIRE( (real_t(c.r) == 1  &&  c.g8 == 0x7F  &&  real_t(c.b) == real_t(0.25)) );
+
+    static_assert(sizeof(n4::Vertex4f) == 16  &&  std::is_trivially_copyable_v<n4::Vertex4f>);
+    static_assert(sizeof(n4::Normal3f) == 16  &&  std::is_trivially_copyable_v<n4::Normal3f>);
+    static_assert(sizeof(n4::Color3f)  == 16  &&  std::is_trivially_copyable_v<n4::Color3f>);
+
+    n4::Vertex4f u;
+    std::memcpy(&u, &v, sizeof(n4::Vertex4f));
+    u.x += 1;
+
+    REQUIRE( (u.x == 2  &&  u.y == 2  &&  v.x == 1) );
   }
 
   TEST_CASE("N4 Vector4f unary operators.", "[Vector4f][unary]") {
@@ -365,6 +395,106 @@ namespace test_n4 {
     REQUIRE( M.isZero(16) );
   }
 
+  TEST_CASE("N4 Matrix4f kernels.", "[Matrix4f][kernels]") {
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    constexpr std::size_t COUNT = 7;
+
+    const Mat4f TS = n4::translate(3, 5, 7)*n4::scale(2, 4, 8);
+
+    for(const cs::ISA isa : {cs::ISA::SSE2, cs::ISA::AVX2, cs::ISA::AVX512}) {
+      if( isa > cs::cpuISA() ) {
+        continue;
+      }
+      std::cout << "ISA: " << cs::isaName(isa) << std::endl;
+
+      const simd::kernels::KernelTable kernels = simd::kernels::table(isa);
+
+      // NOTE: Full registers of AVX2 and AVX-512 plus a remainder.
+      Mat4f Ms[COUNT], Minvs[COUNT];
+      for(std::size_t l = 0; l < COUNT; l++) {
+        Ms[l] = n4::translate(real_t(l), 1, 2)*n4::rotateXbyPI2(int(l))*n4::scale(1, 2, real_t(l + 1));
+      }
+      kernels.inverse(Minvs[0].data(), Ms[0].data(), COUNT);
+      for(std::size_t l = 0; l < COUNT; l++) {
+        REQUIRE( equals(Minvs[l], Ms[l].inverse()) );
+      }
+
+      Vec4f x[COUNT], y[COUNT];
+      for(std::size_t l = 0; l < COUNT; l++) {
+        x[l] = {real_t(l), real_t(2*l), real_t(3*l)};
+      }
+      kernels.transform(y[0].data(), TS.data(), x[0].data(), COUNT);
+      for(std::size_t l = 0; l < COUNT; l++) {
+        const Vec4f Mx = TS*x[l];
+        REQUIRE( equals(Mx, {y[l](0), y[l](1), y[l](2), y[l](3)}) );
+      }
+    }
+  }
+
+  TEST_CASE("N4 Quaternion4f rotations.", "[Quaternion4f][rotate]") {
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    using Quat4f = n4::Quaternion4f;
+
+    const real_t alpha = 0.5;
+    const real_t beta  = -1.25;
+
+    const Quat4f qx = Quat4f::fromAxisAngle(Vec4f{1, 0, 0}, alpha);
+    const Quat4f qz = Quat4f::fromAxisAngle(Vec4f{0, 0, 1}, beta);
+
+    REQUIRE( equals(qx.toMatrix4f(), n4::rotateX(alpha)) );
+    REQUIRE( equals(qz.toMatrix4f(), n4::rotateZ(beta)) );
+
+    const Quat4f q = qx*qz;
+    const Mat4f  R = n4::rotateX(alpha)*n4::rotateZ(beta);
+    REQUIRE( equals(q.toMatrix4f(), R) );
+    REQUIRE( equals(q.length(), 1) );
+
+    const Vec4f v = q.rotate(b);
+    const Vec4f w = R*b;
+    REQUIRE( equals(v, {w(0), w(1), w(2), W0}) );
+
+    const Quat4f e = q*q.conjugate();
+    REQUIRE( equals(e.toMatrix4f(), n4::identity()) );
+    REQUIRE( equals((q*q.inverse()).toMatrix4f(), n4::identity()) );
+
+    // NOTE: Exercise all branches of fromMatrix().
+    for(const Mat4f& M : {R, n4::rotateXbyPI2(2), n4::rotateYbyPI2(2), n4::rotateZbyPI2(2)}) {
+      REQUIRE( equals(Quat4f::fromMatrix(M).toMatrix4f(), M) );
+    }
+
+    using Matrix = cs::NumericArray<double,3,3>;
+
+    const Matrix Rz = cs::rotateZ<Matrix::traits_type>(double(beta));
+    const Matrix Ez = qz.toMatrix3x3<double>() - Rz;
+    REQUIRE( cs::normInf(Ez) <= test_konst::epsilon0 );
+    REQUIRE( equals(Quat4f::fromMatrix(Rz).toMatrix4f(), n4::rotateZ(beta)) );
+  }
+
+  TEST_CASE("N4 Quaternion4f interpolation.", "[Quaternion4f][slerp]") {
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    using Quat4f = n4::Quaternion4f;
+
+    const Vec4f axis{0, 1, 0};
+
+    const Quat4f a = Quat4f::fromAxisAngle(axis, 0.25);
+    const Quat4f b = Quat4f::fromAxisAngle(axis, 1.75);
+
+    REQUIRE( equals(n4::slerp(a, b, 0).toMatrix4f(), a.toMatrix4f()) );
+    REQUIRE( equals(n4::slerp(a, b, 1).toMatrix4f(), b.toMatrix4f()) );
+    REQUIRE( equals(n4::slerp(a, b, 0.25).toMatrix4f(), n4::rotateY(0.625)) );
+
+    // NOTE: -b represents the same rotation as b.
+    const Quat4f nb(-b(0), -b(1), -b(2), -b(3));
+    REQUIRE( equals(n4::slerp(a, nb, 0.5).toMatrix4f(), n4::rotateY(1)) );
+
+    const Quat4f n = n4::nlerp(a, b, 0.5);
+    REQUIRE( equals(n.length(), 1) );
+    REQUIRE( equals(n.toMatrix4f(), n4::rotateY(1)) );
+  }
+
 } // namespace test_n4
 
 namespace test_intersect {
@@ -450,6 +580,354 @@ namespace test_intersect {
     REQUIRE( !test_intersect(min, max, {0, 0, 0}, {-1, -1, -1}) );
   }
 
+  TEST_CASE("Ray/Box intersection interval.", "[intersect]") {
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    using test_equal::equals;
+
+    const Vec4f min{1, 1, 1};
+    const Vec4f max{2, 2, 2};
+
+    const auto intersect = [&](const Vec4f& org, const Vec4f& dir,
+                               const real_t tMin, const real_t tMax, real_t& tNear) -> bool {
+      return simd::intersectRayAABBox(min.eval(), max.eval(), org.eval(),
+                                      simd::inverseDirection(dir.eval()), tMin, tMax, tNear);
+    };
+
+    const real_t inf = std::numeric_limits<real_t>::infinity();
+
+    real_t tNear = -1;
+
+    // Axis Parallel /////////////////////////////////////////////////////////
+
+    REQUIRE(  intersect({0, 1.5, 1.5}, { 1, 0, 0}, 0, inf, tNear) );
+    REQUIRE( equals(tNear, 1) );
+    REQUIRE(  intersect({3, 1.5, 1.5}, {-1, 0, 0}, 0, inf, tNear) );
+    REQUIRE( equals(tNear, 1) );
+    REQUIRE(  intersect({1.5, 1.5, 0}, {0, 0, 2}, 0, inf, tNear) );
+    REQUIRE( equals(tNear, 0.5) );
+    REQUIRE( !intersect({0, 3, 1.5}, {1, 0, 0}, 0, inf, tNear) );
+    REQUIRE( !intersect({0, 1.5, 1.5}, {-1, 0, 0}, 0, inf, tNear) );
+
+    // NOTE: In the plane of a slab.
+    REQUIRE(  intersect({0, 1, 1.5}, {1, 0, 0}, 0, inf, tNear) );
+    REQUIRE( equals(tNear, 1) );
+
+    // Interval //////////////////////////////////////////////////////////////
+
+    REQUIRE(  intersect({0, 1.5, 1.5}, {1, 0, 0}, 0, 1.5, tNear) );
+    REQUIRE( !intersect({0, 1.5, 1.5}, {1, 0, 0}, 0, 0.5, tNear) );
+    REQUIRE( !intersect({0, 1.5, 1.5}, {1, 0, 0}, 2.5, inf, tNear) );
+
+    REQUIRE(  intersect({1.5, 1.5, 1.5}, {1, 1, 1}, 0, inf, tNear) );
+    REQUIRE( equals(tNear, 0) );
+
+    // NOTE: Missing although every axis' slab is hit within [0, inf).
+    REQUIRE( !intersect({0, 0, 0}, {1, 4, 0.25}, 0, inf, tNear) );
+
+    REQUIRE(  intersect({0, 0, 0}, {1, 1, 1}, 0, inf, tNear) );
+    REQUIRE( equals(tNear, 1) );
+    REQUIRE( !intersect({3, 3, 3}, {1, 1, 1}, 0, inf, tNear) );
+  }
+
+  // NOTE: Scalar slab test of lane l as a reference.
+  template<std::size_t WIDTH>
+  bool test_slab(const Vec4f& min, const Vec4f& max,
+                 const simd::RayPacket<WIDTH>& rays, const std::size_t l)
+  {
+    real_t t0 = rays.tMin[l];
+    real_t t1 = rays.tMax[l];
+    for(std::size_t k = 0; k < 3; k++) {
+      const real_t tlo = (min(k) - rays.org[k][l])*rays.invDir[k][l];
+      const real_t thi = (max(k) - rays.org[k][l])*rays.invDir[k][l];
+      t0 = std::max(t0, std::min(tlo, thi));
+      t1 = std::min(t1, std::max(tlo, thi));
+    }
+    return t0 <= t1;
+  }
+
+  template<std::size_t WIDTH>
+  void test_packet(const Vec4f& min, const Vec4f& max,
+                   const Vec4f *org, const Vec4f *dir, const real_t *tMax)
+  {
+    simd::RayPacket<WIDTH> rays;
+    for(std::size_t l = 0; l < WIDTH; l++) {
+      rays.set(l, org[l].data(), dir[l].data(), 0, tMax[l]);
+    }
+
+    alignas(64) real_t tNear[WIDTH], tFar[WIDTH];
+    const int mask = simd::intersectRayPacketAABBox(rays, min.data(), max.data(), tNear, tFar);
+
+    for(std::size_t l = 0; l < WIDTH; l++) {
+      const bool hit = (mask & (1 << l)) != 0;
+      REQUIRE( hit == test_slab(min, max, rays, l) );
+      if( !hit ) {
+        continue;
+      }
+
+      REQUIRE( tNear[l] <= tFar[l] );
+      REQUIRE( tNear[l] >= rays.tMin[l] );
+      REQUIRE( tFar[l]  <= rays.tMax[l] );
+    }
+  }
+
+  TEST_CASE("Ray packet/Box intersection.", "[intersect][packet]") {
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    const Vec4f min{1, 1, 1};
+    const Vec4f max{2, 2, 2};
+
+    constexpr std::size_t COUNT = 16;
+
+    Vec4f  org[COUNT], dir[COUNT];
+    real_t tMax[COUNT];
+    for(std::size_t l = 0; l < COUNT; l++) {
+      const real_t s = real_t(l)/4;
+      org[l]  = {0, s, 1.5};
+      dir[l]  = {1, 0.25, 0.125};
+      tMax[l] = l%3 == 2 ? 1.25 : 10;
+    }
+    org[5] = {1.5, 1.5, 1.5};    // inside
+    dir[7] = {-1, 0, 0};         // pointing away
+
+    const simd::RayPacket4 rays = [&]() {
+      simd::RayPacket4 p;
+      p.set(0, Vec4f{0, 1.5, 1.5}.data(), Vec4f{1, 0, 0}.data());
+      p.set(1, Vec4f{3, 1.5, 1.5}.data(), Vec4f{-1, 0, 0}.data());
+      p.set(2, Vec4f{1.5, 1.5, 1.5}.data(), Vec4f{0, 0, 1}.data());
+      p.set(3, Vec4f{0, 3, 1.5}.data(), Vec4f{1, 0, 0}.data());
+      return p;
+    }();
+
+    alignas(16) real_t tNear[4], tFar[4];
+    REQUIRE( simd::intersectRayPacketAABBox(rays, min.data(), max.data(), tNear, tFar) == 0x7 );
+    REQUIRE( (test_equal::equals(tNear[0], 1)  &&  test_equal::equals(tFar[0], 2)) );
+    REQUIRE( (test_equal::equals(tNear[1], 1)  &&  test_equal::equals(tFar[1], 2)) );
+    REQUIRE( (test_equal::equals(tNear[2], 0)  &&  test_equal::equals(tFar[2], 0.5)) );
+
+    test_packet<4>(min, max, org, dir, tMax);
+    test_packet<4>(min, max, org + 4, dir + 4, tMax + 4);
+    if( cs::cpuISA() >= cs::ISA::AVX2 ) {
+      test_packet<8>(min, max, org, dir, tMax);
+    }
+    if( cs::cpuISA() >= cs::ISA::AVX512 ) {
+      test_packet<16>(min, max, org, dir, tMax);
+    }
+  }
+
+  TEST_CASE("Ray/Triangle intersection.", "[intersect][triangle]") {
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    using test_equal::equals;
+
+    const Vec4f v0{0, 0, 1};
+    const Vec4f v1{2, 0, 1};
+    const Vec4f v2{0, 2, 1};
+    const Vec4f v3{2, 2, 1};
+
+    // NOTE: Lanes 0 & 1 share the edge v1-v2; lane 2 is parallel to z.
+    simd::Triangle4 tris;
+    tris.set(0, v0.data(), v1.data(), v2.data());
+    tris.set(1, v3.data(), v2.data(), v1.data());
+    tris.set(2, Vec4f{0, 0, 0}.data(), Vec4f{1, 0, 0}.data(), Vec4f{0, 0, 1}.data());
+    tris.set(3, Vec4f{0, 0, 4}.data(), Vec4f{2, 0, 4}.data(), Vec4f{0, 2, 4}.data());
+
+    simd::TriangleHit4 hit;
+
+    // 1 Ray vs. 4 Triangles /////////////////////////////////////////////////
+
+    {
+      const Vec4f org{0.5, 0.25, 0};
+      const Vec4f dir{0, 0, 2};
+
+      REQUIRE( simd::intersectRayTriangle4<false>(tris, org.eval(), dir.eval(), 0, 10, hit) == 0x9 );
+      REQUIRE( (equals(hit.t[0], 0.5)  &&  equals(hit.u[0], 0.25)  &&  equals(hit.v[0], 0.125)) );
+      REQUIRE( (equals(hit.t[3], 2)    &&  equals(hit.u[3], 0.25)  &&  equals(hit.v[3], 0.125)) );
+
+      REQUIRE( simd::intersectRayTriangle4<true>(tris, org.eval(), dir.eval(), 0, 10, hit) == 0x9 );
+      REQUIRE( (equals(hit.t[0], 0.5)  &&  equals(hit.u[0], 0.25)  &&  equals(hit.v[0], 0.125)) );
+      REQUIRE( (equals(hit.t[3], 2)    &&  equals(hit.u[3], 0.25)  &&  equals(hit.v[3], 0.125)) );
+
+      REQUIRE( simd::intersectRayTriangle4<false>(tris, org.eval(), dir.eval(), 0, 1, hit) == 0x1 );
+      REQUIRE( simd::intersectRayTriangle4<true>(tris, org.eval(), dir.eval(), 0, 1, hit) == 0x1 );
+    }
+
+    // Watertight Edge ///////////////////////////////////////////////////////
+
+    {
+      const Vec4f org{1, 1, 3};
+      const Vec4f dir{0, 0, -1};
+
+      const int mask = simd::intersectRayTriangle4<true>(tris, org.eval(), dir.eval(), 0, 10, hit);
+      REQUIRE( (mask & 0x3) != 0 );
+      REQUIRE( (mask & 0x8) == 0 );
+      REQUIRE( equals(hit.t[mask & 0x1 ? 0 : 1], 2) );
+    }
+
+    // 4 Rays vs. 1 Triangle /////////////////////////////////////////////////
+
+    {
+      simd::RayPacket4 rays;
+      rays.set(0, Vec4f{0.5, 0.25, 0}.data(), Vec4f{0, 0, 1}.data());
+      rays.set(1, Vec4f{0.5, 0.25, 2}.data(), Vec4f{0, 0, -1}.data());
+      rays.set(2, Vec4f{1.5, 1.5, 0}.data(), Vec4f{0, 0, 1}.data());
+      rays.set(3, Vec4f{-1, 0.5, 1.25}.data(), Vec4f{1, 0, -0.25}.data(), 0, 0.5);
+
+      for(const bool watertight : {false, true}) {
+        const int mask = watertight
+            ? simd::intersectRayPacketTriangle<true>(rays, v0.eval(), v1.eval(), v2.eval(), hit)
+            : simd::intersectRayPacketTriangle<false>(rays, v0.eval(), v1.eval(), v2.eval(), hit);
+        REQUIRE( mask == 0x3 );
+        REQUIRE( (equals(hit.t[0], 1)  &&  equals(hit.u[0], 0.25)  &&  equals(hit.v[0], 0.125)) );
+        REQUIRE( (equals(hit.t[1], 1)  &&  equals(hit.u[1], 0.25)  &&  equals(hit.v[1], 0.125)) );
+      }
+
+      rays.tMax[3] = 2;
+      REQUIRE( simd::intersectRayPacketTriangle<false>(rays, v0.eval(), v1.eval(), v2.eval(), hit) == 0xB );
+      REQUIRE( simd::intersectRayPacketTriangle<true>(rays, v0.eval(), v1.eval(), v2.eval(), hit) == 0xB );
+      REQUIRE( (equals(hit.t[3], 1)  &&  equals(hit.u[3], 0)  &&  equals(hit.v[3], 0.25)) );
+    }
+  }
+
+  // NOTE: Triangle soup; large enough to build subtrees in parallel.
+  constexpr std::size_t COUNT = 6000;
+
+  void make_soup(std::vector<Vec4f>& vertices, std::vector<std::uint32_t>& indices,
+                 const std::size_t count)
+  {
+    std::mt19937 gen(0xC0FFEE);
+    std::uniform_real_distribution<real_t> pos(0, 10);
+    std::uniform_real_distribution<real_t> off(-0.5, 0.5);
+
+    for(std::size_t i = 0; i < count; i++) {
+      const Vec4f c{pos(gen), pos(gen), pos(gen)};
+      for(std::size_t j = 0; j < 3; j++) {
+        indices.push_back(static_cast<std::uint32_t>(vertices.size()));
+        vertices.push_back(c + Vec4f{off(gen), off(gen), off(gen)});
+      }
+    }
+  }
+
+  TEST_CASE("BVH intersection.", "[intersect][bvh]") {
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    using test_equal::equals;
+
+    std::mt19937 gen(0x5EED);
+    std::uniform_real_distribution<real_t> pos(0, 10);
+    std::uniform_real_distribution<real_t> off(-0.5, 0.5);
+
+    std::vector<Vec4f>         vertices;
+    std::vector<std::uint32_t> indices;
+    make_soup(vertices, indices, COUNT);
+
+    // Reference: All triangles, four at a time.
+    std::vector<simd::Triangle4> soup((COUNT + 3)/4);
+    for(std::size_t i = 0; i < soup.size()*4; i++) {
+      const std::size_t id = std::min(i, COUNT - 1);
+      const Vec4f& p0 = vertices[indices[3*id]];
+      soup[i/4].set(i%4, p0.data(),
+                    (i < COUNT ? vertices[indices[3*id + 1]] : p0).data(),
+                    (i < COUNT ? vertices[indices[3*id + 2]] : p0).data());
+    }
+
+    const auto brute = [&](const Vec4f& org, const Vec4f& dir, n4::BVHHit& hit) -> bool {
+      bool found = false;
+      real_t tMax = std::numeric_limits<real_t>::infinity();
+      for(std::size_t b = 0; b < soup.size(); b++) {
+        simd::TriangleHit4 tris;
+        const int mask = simd::intersectRayTriangle4(soup[b], org.eval(), dir.eval(), 0, tMax, tris);
+        for(std::size_t l = 0; l < 4; l++) {
+          if( (mask & (1 << l)) != 0  &&  4*b + l < COUNT  &&  tris.t[l] <= tMax ) {
+            tMax = hit.t = tris.t[l];
+            hit.triangle = static_cast<std::uint32_t>(4*b + l);
+            found = true;
+          }
+        }
+      }
+      return found;
+    };
+
+    for(const std::size_t threads : {1, 4}) {
+      n4::BVH bvh;
+      bvh.build(vertices.data(), indices.data(), COUNT, threads);
+
+      REQUIRE( bvh.triangleIds().size() == 4*bvh.triangles().size() );
+      REQUIRE( bvh.nodes().size() == 2*bvh.triangles().size() - 1 );
+
+      std::size_t hits = 0;
+      for(std::size_t r = 0; r < 256; r++) {
+        const Vec4f org{pos(gen), pos(gen), -1};
+        const Vec4f dir = n4::normalize(Vec4f{off(gen), off(gen), 1});
+
+        n4::BVHHit expect, hit;
+        const bool isHit = brute(org, dir, expect);
+        REQUIRE( bvh.intersect(org, dir, hit) == isHit );
+        REQUIRE( bvh.occluded(org, dir) == isHit );
+        if( isHit ) {
+          REQUIRE( hit.triangle == expect.triangle );
+          REQUIRE( equals(hit.t, expect.t) );
+          REQUIRE( !bvh.occluded(org, dir, 0, expect.t*0.99f) );
+          hits++;
+        }
+      }
+      REQUIRE( hits > 64 );
+    }
+
+    n4::BVH empty;
+    empty.build(vertices.data(), indices.data(), 0);
+    REQUIRE( !empty.occluded(Vec4f{0, 0, 0}, Vec4f{0, 0, 1}) );
+  }
+
+  TEST_CASE("QBVH intersection.", "[intersect][bvh]") {
+    std::cout << "*** " << Catch::getResultCapture().getCurrentTestName() << std::endl;
+
+    using test_equal::equals;
+
+    std::mt19937 gen(0x5EED);
+    std::uniform_real_distribution<real_t> pos(0, 10);
+    std::uniform_real_distribution<real_t> off(-0.5, 0.5);
+
+    std::vector<Vec4f>         vertices;
+    std::vector<std::uint32_t> indices;
+    make_soup(vertices, indices, COUNT);
+
+    n4::BVH bvh;
+    bvh.build(vertices.data(), indices.data(), COUNT);
+
+    n4::QBVH qbvh;
+    qbvh.build(bvh);
+
+    // NOTE: Fewer nodes than the binary BVH's inner nodes.
+    REQUIRE( qbvh.nodes().size() < bvh.nodes().size()/2 );
+    REQUIRE( qbvh.triangles().size() == bvh.triangles().size() );
+
+    std::size_t hits = 0;
+    for(std::size_t r = 0; r < 256; r++) {
+      const Vec4f org{pos(gen), pos(gen), -1};
+      const Vec4f dir = n4::normalize(Vec4f{off(gen), off(gen), 1});
+
+      n4::BVHHit expect, hit;
+      const bool isHit = bvh.intersect(org, dir, expect);
+      REQUIRE( qbvh.intersect(org, dir, hit) == isHit );
+      REQUIRE( qbvh.occluded(org, dir) == isHit );
+      if( isHit ) {
+        REQUIRE( hit.triangle == expect.triangle );
+        REQUIRE( equals(hit.t, expect.t) );
+        REQUIRE( !qbvh.occluded(org, dir, 0, expect.t*0.99f) );
+        hits++;
+      }
+    }
+    REQUIRE( hits > 64 );
+
+    // NOTE: A single leaf.
+    n4::QBVH single;
+    single.build(vertices.data(), indices.data(), 1);
+    REQUIRE( single.nodes().size() == 1 );
+    const Vec4f center = (vertices[0] + vertices[1] + vertices[2])/3;
+    REQUIRE( single.occluded(Vec4f{0, 0, -1}, center - Vec4f{0, 0, -1}) );
+  }
+
 } // namespace test_intersect
 
 namespace test_optics {